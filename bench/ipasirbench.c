@@ -0,0 +1,125 @@
+/* Micro-benchmark for loading formulas through the IPASIR interface.
+ *
+ * Each DIMACS file given on the command line is parsed into memory once
+ * and then repeatedly loaded into a fresh solver, either literal by literal
+ * with 'ipasir_add' or all at once with 'ipasir_add_clauses'.  Only the
+ * time spent in 'ipasir_init', loading and 'ipasir_release' is measured.
+ */
+
+#include "ipasir.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+static int rounds = 10;
+
+static double
+now (void)
+{
+  struct timeval tv;
+  gettimeofday (&tv, 0);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+static void
+die (const char *msg, const char *path)
+{
+  fprintf (stderr, "ipasirbench: %s '%s'\n", msg, path);
+  exit (1);
+}
+
+/* Parse all literals including terminating zeros and skip comments and
+ * the header.  Returns the number of literals stored in '*res'.
+ */
+static int
+parse (const char *path, int **res)
+{
+  int ch, sign, lit, size = 0, capacity = 1 << 16;
+  int *lits = malloc (capacity * sizeof *lits);
+  FILE *file = fopen (path, "r");
+  if (!file)
+    die ("can not read", path);
+  while ((ch = getc (file)) != EOF)
+    {
+      if (ch == 'c' || ch == 'p')
+	{
+	  while ((ch = getc (file)) != '\n' && ch != EOF)
+	    ;
+	  continue;
+	}
+      if (isspace (ch))
+	continue;
+      sign = 1;
+      if (ch == '-')
+	sign = -1, ch = getc (file);
+      if (!isdigit (ch))
+	die ("invalid literal in", path);
+      lit = ch - '0';
+      while (isdigit (ch = getc (file)))
+	lit = 10 * lit + (ch - '0');
+      if (size == capacity)
+	lits = realloc (lits, (capacity *= 2) * sizeof *lits);
+      lits[size++] = sign * lit;
+    }
+  fclose (file);
+  *res = lits;
+  return size;
+}
+
+static double
+load_literals (const int *lits, int size)
+{
+  double start = now ();
+  void *solver = ipasir_init ();
+  int i;
+  for (i = 0; i < size; i++)
+    ipasir_add (solver, lits[i]);
+  ipasir_release (solver);
+  return now () - start;
+}
+
+static double
+load_clauses (const int *lits, int size)
+{
+  double start = now ();
+  void *solver = ipasir_init ();
+  ipasir_add_clauses (solver, lits, size);
+  ipasir_release (solver);
+  return now () - start;
+}
+
+int
+main (int argc, char **argv)
+{
+  double literals, clauses, total_literals = 0, total_clauses = 0;
+  int i, r, size, *lits;
+  const char *env = getenv ("IPASIRBENCH_ROUNDS");
+  if (env)
+    rounds = atoi (env);
+  printf ("%s %d rounds\n", ipasir_signature (), rounds);
+  printf ("%12s %12s %12s %8s  %s\n",
+	  "literals", "add [ms]", "bulk [ms]", "speedup", "file");
+  for (i = 1; i < argc; i++)
+    {
+      size = parse (argv[i], &lits);
+      literals = clauses = 0;
+      for (r = 0; r < rounds; r++)
+	{
+	  literals += load_literals (lits, size);
+	  clauses += load_clauses (lits, size);
+	}
+      printf ("%12d %12.3f %12.3f %8.2f  %s\n",
+	      size, 1e3 * literals / rounds, 1e3 * clauses / rounds,
+	      clauses > 0 ? literals / clauses : 0, argv[i]);
+      total_literals += literals;
+      total_clauses += clauses;
+      free (lits);
+    }
+  printf ("%12s %12.3f %12.3f %8.2f  total\n", "",
+	  1e3 * total_literals / rounds, 1e3 * total_clauses / rounds,
+	  total_clauses > 0 ? total_literals / total_clauses : 0);
+  return 0;
+}
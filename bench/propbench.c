@@ -0,0 +1,169 @@
+/* Micro-benchmark for unit propagation in CaDiCaL with and without
+ * prefetching clauses ('--prefetch').
+ *
+ * Each DIMACS file given on the command line is parsed into memory once
+ * and loaded into two fresh solvers, one with 'prefetch' disabled and one
+ * with the given prefetch distance.  Then both solvers propagate the same
+ * sequence of random assumption sets with 'ccadical_propagate'.  Only the
+ * time spent in propagation is measured.
+ */
+
+#include "ccadical.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+static int rounds = 1000;
+static int assumptions = 10;
+static int distance = 16;
+
+static double
+now (void)
+{
+  struct timeval tv;
+  gettimeofday (&tv, 0);
+  return tv.tv_sec + 1e-6 * tv.tv_usec;
+}
+
+static void
+die (const char *msg, const char *path)
+{
+  fprintf (stderr, "propbench: %s '%s'\n", msg, path);
+  exit (1);
+}
+
+/* Parse all literals including terminating zeros and skip comments and
+ * the header.  Returns the number of literals stored in '*res' and the
+ * maximum variable index in '*max'.
+ */
+static int
+parse (const char *path, int **res, int *max)
+{
+  int ch, sign, lit, size = 0, capacity = 1 << 16;
+  int *lits = malloc (capacity * sizeof *lits);
+  FILE *file = fopen (path, "r");
+  if (!file)
+    die ("can not read", path);
+  *max = 0;
+  while ((ch = getc (file)) != EOF)
+    {
+      if (ch == 'c' || ch == 'p')
+	{
+	  while ((ch = getc (file)) != '\n' && ch != EOF)
+	    ;
+	  continue;
+	}
+      if (isspace (ch))
+	continue;
+      sign = 1;
+      if (ch == '-')
+	sign = -1, ch = getc (file);
+      if (!isdigit (ch))
+	die ("invalid literal in", path);
+      lit = ch - '0';
+      while (isdigit (ch = getc (file)))
+	lit = 10 * lit + (ch - '0');
+      if (lit > *max)
+	*max = lit;
+      if (size == capacity)
+	lits = realloc (lits, (capacity *= 2) * sizeof *lits);
+      lits[size++] = sign * lit;
+    }
+  fclose (file);
+  *res = lits;
+  return size;
+}
+
+/* Same linear congruential generator as in the API tests, restarted for
+ * each solver, so both propagate the same assumptions.
+ */
+static unsigned state;
+
+static int
+pick (int max)
+{
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+/* Returns the propagation time and adds the number of implied literals
+ * (including conflicting rounds as zero) to '*implied'.
+ */
+static double
+propagate (const int *lits, int size, int max, int prefetch,
+	   long *implied)
+{
+  int *assumed = malloc (assumptions * sizeof *assumed);
+  CCaDiCaL *solver = ccadical_init ();
+  double start;
+  int i, r, idx, res;
+  ccadical_set_option (solver, "tiny", 0);
+  ccadical_set_option (solver, "prefetch", prefetch);
+  ccadical_add_clauses (solver, lits, size);
+  ccadical_propagate (solver, 0, 0, 0, 0);	/* root level units */
+  state = 1;
+  *implied = 0;
+  start = now ();
+  for (r = 0; r < rounds; r++)
+    {
+      for (i = 0; i < assumptions; i++)
+	{
+	  idx = 1 + pick (max);
+	  assumed[i] = pick (2) ? idx : -idx;
+	}
+      res = ccadical_propagate (solver, assumed, assumptions, 0, 0);
+      if (res > 0)
+	*implied += res;
+    }
+  start = now () - start;
+  ccadical_release (solver);
+  free (assumed);
+  return start;
+}
+
+int
+main (int argc, char **argv)
+{
+  double off, on, total_off = 0, total_on = 0;
+  long implied, checked, total_implied = 0;
+  int i, size, max, *lits;
+  const char *env;
+  if ((env = getenv ("PROPBENCH_ROUNDS")))
+    rounds = atoi (env);
+  if ((env = getenv ("PROPBENCH_ASSUMPTIONS")))
+    assumptions = atoi (env);
+  if ((env = getenv ("PROPBENCH_PREFETCH")))
+    distance = atoi (env);
+  if (assumptions < 1)
+    assumptions = 1;
+  printf ("%s %d rounds %d assumptions prefetch %d\n",
+	  ccadical_signature (), rounds, assumptions, distance);
+  printf ("%12s %12s %12s %8s  %s\n",
+	  "implied", "off [ms]", "on [ms]", "speedup", "file");
+  for (i = 1; i < argc; i++)
+    {
+      size = parse (argv[i], &lits, &max);
+      if (!max)
+	{
+	  free (lits);
+	  continue;
+	}
+      off = propagate (lits, size, max, 0, &implied);
+      on = propagate (lits, size, max, distance, &checked);
+      if (checked != implied)
+	die ("different propagation results on", argv[i]);
+      printf ("%12ld %12.3f %12.3f %8.2f  %s\n",
+	      implied, 1e3 * off, 1e3 * on, on > 0 ? off / on : 0, argv[i]);
+      total_implied += implied;
+      total_off += off;
+      total_on += on;
+      free (lits);
+    }
+  printf ("%12ld %12.3f %12.3f %8.2f  total\n", total_implied,
+	  1e3 * total_off, 1e3 * total_on,
+	  total_on > 0 ? total_off / total_on : 0);
+  return 0;
+}
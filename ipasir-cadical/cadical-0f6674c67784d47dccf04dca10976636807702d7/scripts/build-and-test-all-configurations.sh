@@ -100,4 +100,7 @@ run -m32 -a -p
 run --no-unlocked -q
 run --no-unlocked -a -p
 
+run --watch32
+run --watch32 -a -p
+
 echo "successfully compiled and tested ${GOOD}${ok}${NORMAL} configurations"
@@ -0,0 +1,67 @@
+#!/bin/sh
+
+# Compare propagations per second of the default 16 byte watches and the
+# 8 byte watches with 32-bit clause references ('./configure --watch32').
+# Both configurations are built in 'build-watch16' and 'build-watch8' in
+# the root directory.  Without arguments all CNFs in 'test/cnf' are used.
+#
+#   ./scripts/compare-watch-layouts.sh [ <dimacs> ... ]
+
+. `dirname $0`/colors.sh || exit 1
+
+die () {
+  echo "compare-watch-layouts.sh: ${BAD}error${NORMAL}: $*" 1>&2
+  exit 1
+}
+
+root="`dirname $0`/.."
+root="`cd $root; pwd`"
+
+[ -f $root/configure ] || die "can not find '$root/configure'"
+
+build () {
+  dir=$root/build-$1
+  shift
+  if [ ! -f $dir/cadical ]
+  then
+    mkdir -p $dir || die "could not generate '$dir'"
+    echo "cd $dir && ../configure $* && make"
+    ( cd $dir && ../configure $* && make ) >/dev/null 2>&1 || \
+    die "building in '$dir' failed"
+  fi
+}
+
+build watch16
+build watch8 --watch32
+
+[ $# = 0 ] && set -- $root/test/cnf/*.cnf
+
+# Prints propagations and process time of one run.
+
+run () {
+  $root/build-$1/cadical $2 2>/dev/null | \
+  awk '/^c propagations:/{p=$3}
+       /^c total process time/{t=$(NF-1)}
+       END{print p, t}'
+}
+
+printf "%10s %8s %8s %8s %8s %6s  %s\n" \
+  propagations watch16 M/sec watch8 M/sec ratio name
+
+for cnf in $*
+do
+  set -- `run watch16 $cnf` `run watch8 $cnf`
+  echo "$1 $2 $3 $4 $cnf"
+done | \
+awk '
+function rate(p,t) { return t > 0 ? p/t/1e6 : 0 }
+{
+  name = $5; sub (/.*\//, "", name)
+  printf "%10d %8.2f %8.2f %8.2f %8.2f %6.2f  %s\n",
+    $1, $2, rate($1,$2), $4, rate($3,$4), ($4 > 0 ? $2/$4 : 0), name
+  p16 += $1; t16 += $2; p8 += $3; t8 += $4
+}
+END {
+  printf "%10d %8.2f %8.2f %8.2f %8.2f %6.2f  total\n",
+    p16, t16, rate(p16,t16), t8, rate(p8,t8), (t8 > 0 ? t16/t8 : 0)
+}'
@@ -16,6 +16,7 @@ void Internal::learn_empty_clause () {
   assert (!unsat);
   LOG ("learned empty clause");
   external->check_learned_empty_clause ();
+  if (external->learner) external->export_learned_empty_clause ();
   if (proof) proof->add_derived_empty_clause ();
   unsat = true;
 }
@@ -23,6 +24,7 @@ void Internal::learn_empty_clause () {
 void Internal::learn_unit_clause (int lit) {
   LOG ("learned unit clause %d", lit);
   external->check_learned_unit_clause (lit);
+  if (external->learner) external->export_learned_unit_clause (lit);
   if (proof) proof->add_derived_unit_clause (lit);
   mark_fixed (lit);
 }
@@ -249,7 +251,7 @@ inline void Internal::bump_also_reason_literals (int lit, int limit) {
   const Var & v = var (lit);
   assert (val (lit));
   if (!v.level) return;
-  Clause * reason = v.reason;
+  Clause * reason = rtab[vidx (lit)].clause;
   if (!reason) return;
   for (const auto & other : *reason) {
     if (other == lit)  continue;
@@ -663,7 +665,7 @@ void Internal::analyze () {
       if (var (lit).level == level) uip = lit;
     }
     if (!--open) break;
-    reason = var (uip).reason;
+    reason = rtab[vidx (uip)].clause;
     LOG (reason, "analyzing %d reason", uip);
   }
   LOG ("first UIP %d", uip);
@@ -1,7 +1,13 @@
 #include "internal.hpp"
 
+#ifdef WATCH32
+#include <mutex>
+#endif
+
 namespace CaDiCaL {
 
+#ifndef WATCH32
+
 Arena::Arena (Internal * i) {
   memset (this, 0, sizeof *this);
   internal = i;
@@ -10,6 +16,7 @@ Arena::Arena (Internal * i) {
 Arena::~Arena () {
   delete [] from.start;
   delete [] to.start;
+  delete [] nursery.start;
 }
 
 void Arena::prepare (size_t bytes) {
@@ -25,6 +32,114 @@ void Arena::swap () {
     (size_t) (from.end - from.start));
   from = to;
   to.start = to.top = to.end = 0;
+  LOG ("delete nursery of arena with %zd bytes (%zd bytes requested)",
+    (size_t) (nursery.end - nursery.start), requested);
+  delete [] nursery.start;
+  if (requested) {
+    const size_t bytes = requested + requested/2;
+    nursery.top = nursery.start = new char[bytes];
+    nursery.end = nursery.start + bytes;
+  } else nursery.start = nursery.top = nursery.end = 0;
+  requested = 0;
 }
 
+#else
+
+/*------------------------------------------------------------------------*/
+
+const unsigned Arena::slot_bits;
+const unsigned Arena::offset_bits;
+const size_t Arena::chunk_bytes;
+
+char * Arena::chunks[1u << Arena::slot_bits];
+
+static std::mutex chunks_mutex;
+static unsigned chunks_hint;
+
+Arena::Arena (Internal * i) : internal (i) {
+  from.top = from.end = 0;
+  to.top = to.end = 0;
+  fresh.top = fresh.end = 0;
+}
+
+Arena::~Arena () {
+  release (from);
+  release (to);
+  release (fresh);
+}
+
+// Allocates 'bytes' (rounded up to a multiple of 8) in 'space' and starts
+// a new chunk if necessary.  Clauses larger than a chunk get a chunk of
+// their own which is then full immediately, such that all clauses start
+// within the first 'chunk_bytes' of their chunk.
+
+char * Arena::allocate (Space & space, size_t bytes, bool copied) {
+  bytes = (bytes + 7) & ~(size_t) 7;
+  if (bytes > (size_t) (space.end - space.top)) {
+    const size_t header = (sizeof (Chunk) + 7) & ~(size_t) 7;
+    const size_t size = max (chunk_bytes, header + bytes);
+    char * memory = new char[size + chunk_bytes];
+    char * start = memory + (chunk_bytes -
+      ((size_t) memory & (chunk_bytes - 1)));
+    unsigned slot;
+    {
+      std::lock_guard<std::mutex> lock (chunks_mutex);
+      const unsigned slots = 1u << slot_bits;
+      for (slot = 0; slot < slots; slot++)
+        if (!chunks[(chunks_hint + slot) & (slots - 1)]) break;
+      if (slot == slots) {
+        delete [] memory;
+        FATAL ("out of 32-bit clause references (%zd chunks of %zd bytes)",
+          (size_t) slots, chunk_bytes);
+      }
+      slot = (chunks_hint + slot) & (slots - 1);
+      chunks[slot] = start;
+      chunks_hint = slot + 1;
+    }
+    Chunk * chunk = (Chunk *) start;
+    chunk->memory = memory;
+    chunk->slot = slot;
+    chunk->copied = copied;
+    space.chunks.push_back (start);
+    space.top = start + header;
+    space.end = start + size;
+    LOG ("new arena chunk %u of %zd bytes", slot, size);
+  }
+  char * res = space.top;
+  space.top += bytes;
+  return res;
+}
+
+void Arena::release (Space & space) {
+  LOG ("releasing %zd arena chunks", space.chunks.size ());
+  for (const auto & start : space.chunks) {
+    Chunk * chunk = (Chunk *) start;
+    char * memory = chunk->memory;
+    {
+      std::lock_guard<std::mutex> lock (chunks_mutex);
+      chunks[chunk->slot] = 0;
+    }
+    delete [] memory;
+  }
+  space.chunks.clear ();
+  space.top = space.end = 0;
+}
+
+// The 'to' space grows chunk by chunk during copying and thus 'bytes' is
+// not needed here.
+
+void Arena::prepare (size_t bytes) {
+  LOG ("preparing 'to' space of arena for %zd bytes", bytes);
+  assert (to.chunks.empty ());
+  (void) bytes;
+}
+
+void Arena::swap () {
+  release (from);
+  release (fresh);
+  std::swap (from, to);
+}
+
+#endif
+
 }
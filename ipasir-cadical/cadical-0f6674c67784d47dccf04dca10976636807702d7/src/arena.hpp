@@ -1,6 +1,8 @@
 #ifndef _arena_hpp_INCLUDED
 #define _arena_hpp_INCLUDED
 
+#include <vector>
+
 namespace CaDiCaL {
 
 // This memory allocation arena provides fixed size pre-allocated memory for
@@ -18,16 +20,28 @@ namespace CaDiCaL {
 // pointers.  This would restrict the maximum number of clauses and thus is
 // a restriction we do not want to use anymore.
 
-// New learned clauses are allocated in CaDiCaL outside of this arena and
-// moved to the arena during garbage collection.  The additional 'to' space
-// required for such a moving garbage collector is only allocated for those
-// clauses surviving garbage collection, which usually needs much less
-// memory than all clauses.  The net effect is that in our implementation
-// the moving garbage collector using this arena only needs roughly 50% more
-// memory than allocating the clauses directly.  Both implementations can be
+// New clauses are allocated in CaDiCaL outside of this arena and moved to
+// the arena during garbage collection.  The additional 'to' space required
+// for such a moving garbage collector is only allocated for those clauses
+// surviving garbage collection, which usually needs much less memory than
+// all clauses.  The net effect is that in our implementation the moving
+// garbage collector using this arena only needs roughly 50% more memory
+// than allocating the clauses directly.  Both implementations can be
 // compared by varying the 'opts.arenatype' option (which also controls the
 // allocation order of clauses during moving them).
 
+// The exception are learned clauses, which are allocated in a 'nursery'
+// (unless 'opts.arenanursery' is disabled) by just bumping its 'top'
+// pointer.  This avoids calling the allocator for every learned clause and
+// keeps recently learned clauses, which are the most propagated ones,
+// close to each other until the next moving garbage collection, which then
+// copies the survivors to 'to' space like all other clauses.  Afterwards
+// the whole nursery is released in 'swap' and a new one is allocated with
+// one and a half times the size requested since the previous 'swap'.  If
+// the nursery is exhausted (or has not been allocated yet, which is the
+// case before the first 'swap'), learned clauses are allocated outside of
+// the arena as before.
+
 // The standard sequence of using the arena is as follows:
 //
 //   Arena arena;
@@ -39,7 +53,7 @@ namespace CaDiCaL {
 //   assert (bytes1 + ... + bytesn <= bytes);
 //   arena.swap ();
 //   ...
-//   if (!arena.contains (q)) delete q;
+//   if (!arena.contains (q) && !arena.nursery_contains (q)) delete q;
 //   ...
 //   arena.prepare (bytes);
 //   q1 = arena.copy (p1, bytes1);
@@ -51,16 +65,84 @@ namespace CaDiCaL {
 //
 // One has to be really careful with 'qi' references to arena memory.
 
+// If compiled with '-DWATCH32' (configure option '--watch32') all clauses
+// are allocated in the arena, which then consists of 'chunk_bytes' sized
+// chunks aligned to 'chunk_bytes'.  This allows watches to refer to clauses
+// by 32-bit references (see 'watch.hpp'), which consist of the slot of the
+// chunk in the global 'chunks' table, the offset of the clause in its chunk
+// in multiples of 8 bytes and one bit for binary clauses.  Clauses larger
+// than a chunk get their own (larger) chunk.  Chunks never move and thus
+// clause pointers remain valid as before.  New clauses are allocated in the
+// 'fresh' space which is then reclaimed together with 'from' during 'swap'.
+// Deleted clauses are only reclaimed in this way and thus garbage
+// collection always has to use the arena (see 'arenaing').  Thus the
+// 'fresh' space already plays the role of the nursery described above (for
+// all clauses) and there is no separate nursery.  The global table is
+// shared by all solvers of the process and limits the total memory for
+// clauses to 16 GB.
+
 struct Internal;
 
 class Arena {
 
   Internal * internal;
 
-  struct { char * start, * top, * end; } from, to;
+#ifndef WATCH32
+  struct { char * start, * top, * end; } from, to, nursery;
+  size_t requested;     // bytes requested from 'nursery' since 'swap'
+#else
+  struct Space { std::vector<char *> chunks; char * top, * end; };
+  Space from, to, fresh;
+  char * allocate (Space &, size_t bytes, bool copied);
+  void release (Space &);
+#endif
 
 public:
 
+#ifdef WATCH32
+  static const unsigned slot_bits = 14, offset_bits = 17;
+  static const size_t chunk_bytes = (size_t) 8 << offset_bits;
+  static char * chunks[1u << slot_bits];
+
+  // Header at the start of each chunk.
+
+  struct Chunk { char * memory; unsigned slot; bool copied; };
+
+  static unsigned reference (const void * p) {
+    const size_t offset = (size_t) p & (chunk_bytes - 1);
+    const Chunk * chunk = (const Chunk *) ((const char *) p - offset);
+    assert (!(offset & 7));
+    return (chunk->slot << (offset_bits + 1)) | (unsigned) (offset >> 2);
+  }
+
+  static void * dereference (unsigned ref) {
+    const unsigned mask = (1u << (offset_bits + 1)) - 2;
+    return chunks[ref >> (offset_bits + 1)] + 4 * (size_t) (ref & mask);
+  }
+
+  // Allocate a new clause of that size in the 'fresh' space.
+  //
+  char * allocate (size_t bytes) { return allocate (fresh, bytes, false); }
+#else
+  // Allocate a new learned clause in the 'nursery'.  Returns zero if the
+  // nursery does not have enough space left.
+  //
+  char * allocate (size_t bytes) {
+    requested += bytes;
+    if (bytes > (size_t) (nursery.end - nursery.top)) return 0;
+    char * res = nursery.top;
+    nursery.top += bytes;
+    return res;
+  }
+
+  // Has the memory pointed to by 'p' been allocated by 'allocate'?
+  //
+  bool nursery_contains (void * p) const {
+    char * c = (char *) p;
+    return nursery.start <= c && c < nursery.top;
+  }
+#endif
+
   Arena (Internal *);
   ~Arena ();
 
@@ -74,8 +156,13 @@ public:
   // to the 'from' space, since that is the only one remaining after 'swap'.
   //
   bool contains (void * p) const {
+#ifndef WATCH32
     char * c = (char *) p;
     return from.start <= c && c < from.top;
+#else
+    const size_t offset = (size_t) p & (chunk_bytes - 1);
+    return ((const Chunk *) ((const char *) p - offset))->copied;
+#endif
   }
 
   // Allocate that amount of memory in 'to' space.  This assumes the 'to'
@@ -84,16 +171,21 @@ public:
   // not matter whether 'p' is in 'from' or allocated outside of the arena.
   //
   char * copy (const char * p, size_t bytes) {
+#ifndef WATCH32
     char * res = to.top;
     to.top += bytes;
     assert (to.top <= to.end);
+#else
+    char * res = allocate (to, bytes, true);
+#endif
     memcpy (res, p, bytes);
     return res;
   }
 
   // Completely delete 'from' space and then replace 'from' by 'to' (by
-  // pointer swapping).  Everything previously allocated (in 'from') and not
-  // explicitly copied to 'to' with 'copy' becomes invalid.
+  // pointer swapping).  Everything previously allocated (in 'from' or in
+  // the 'nursery') and not explicitly copied to 'to' with 'copy' becomes
+  // invalid.
   //
   void swap ();
 };
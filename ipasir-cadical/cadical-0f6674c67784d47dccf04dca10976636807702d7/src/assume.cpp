@@ -108,10 +108,11 @@ void Internal::failing () {
         Var & v = var (lit);
         if (!v.level) continue;
 
-        if (v.reason) {
+        Clause * reason = rtab[vidx (lit)].clause;
+        if (reason) {
           assert (v.level);
-          LOG (v.reason, "analyze reason");
-          for (const auto & other : *v.reason) {
+          LOG (reason, "analyze reason");
+          for (const auto & other : *reason) {
             Flags & f = flags (other);
             if (f.seen) continue;
             f.seen = true;
@@ -154,6 +155,46 @@ void Internal::failing () {
   STOP (analyze);
 }
 
+// Propagate the assumptions as decisions, one decision level each, but do
+// not search, as used by 'Solver::propagate'.  Returns '20' if the formula
+// (after restoring clauses) or the assumptions propagate to a conflict and
+// zero otherwise, in which case all literals implied by the assumptions
+// (and the assumptions themselves) are on the trail above the root level.
+// The caller has to backtrack.
+
+int Internal::propagate_assumptions () {
+  assert (clause.empty ());
+  if (level) backtrack ();
+  if (unsat) return 20;
+  if (!propagate ()) {
+    LOG ("root level propagation produces conflict");
+    learn_empty_clause ();
+    return 20;
+  }
+  if (opts.restoreall > 1 || !external->tainted.empty ()) {
+    external->restore_clauses ();
+    if (!unsat && !propagate ()) {
+      LOG ("root level propagation after restore produces conflict");
+      learn_empty_clause ();
+    }
+    if (unsat) return 20;
+  }
+  for (const auto & lit : assumptions) {
+    const int tmp = val (lit);
+    if (tmp > 0) continue;
+    if (tmp < 0) {
+      LOG ("assumption %d falsified", lit);
+      return 20;
+    }
+    search_assume_decision (lit);
+    if (propagate ()) continue;
+    LOG ("propagating assumption %d produces conflict", lit);
+    conflict = 0;
+    return 20;
+  }
+  return 0;
+}
+
 // Add the start of each incremental phase (leaving the state
 // 'UNSATISFIABLE' actually) we reset all assumptions.
 
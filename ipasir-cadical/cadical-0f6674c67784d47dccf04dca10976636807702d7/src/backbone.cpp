@@ -0,0 +1,102 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Backbone computation on top of incremental solving under assumptions.
+// The literals of the first model are the candidates.  Then the negations
+// of a chunk of at most 'opts.backbonechunk' candidates are assumed (in
+// addition to the user assumptions).  If this is satisfiable the new model
+// refutes all candidates of the chunk and all other candidates it falsifies
+// too.  Otherwise if exactly one negated candidate failed this candidate is
+// in the backbone.  If more than one failed, chunks shrink to single
+// candidates until the next satisfiable call.  Candidates which become
+// fixed at the root level, e.g., through units learned while refuting
+// other candidates, are moved to the backbone without solving.  Saved
+// phases are set to falsify all candidates to get models refuting as many
+// of them as possible.
+
+void External::backbone_phases (const vector<int> & candidates) {
+  for (const auto & elit : candidates) {
+    const int ilit = e2i[abs (elit)];
+    if (!ilit) continue;
+    const int tmp = (elit > 0) == (ilit > 0) ? -1 : 1;
+    internal->phases.saved[abs (ilit)] = tmp;
+  }
+}
+
+int External::backbone (vector<int> & backbone) {
+
+  backbone.clear ();
+  const vector<int> assumed = assumptions;
+
+  int res = solve ();
+  if (res != 10) return res;
+
+  vector<int> candidates;
+  variables (candidates);
+  for (auto & lit : candidates) lit = val (lit);
+
+  const size_t max_chunk = internal->opts.backbonechunk;
+  size_t chunk = max_chunk;
+  int64_t calls = 1;
+  bool complete = false;
+
+  for (;;) {
+
+    const auto end = candidates.end ();
+    auto j = candidates.begin ();
+    for (auto i = j; i != end; i++) {
+      const int elit = *i;
+      if (fixed (elit) > 0) backbone.push_back (elit);
+      else *j++ = elit;
+    }
+    candidates.resize (j - candidates.begin ());
+    if (candidates.empty ()) { complete = true; break; }
+
+    reset_assumptions ();
+    for (const auto & elit : assumed)
+      assume (elit);
+    const size_t size = min (chunk, candidates.size ());
+    for (size_t i = 0; i < size; i++)
+      assume (-candidates[i]);
+    backbone_phases (candidates);
+
+    res = solve ();
+    calls++;
+
+    if (res == 10) {
+      j = candidates.begin ();
+      for (auto i = j; i != candidates.end (); i++)
+        if (val (abs (*i)) == *i) *j++ = *i;
+      candidates.resize (j - candidates.begin ());
+      chunk = min (2*chunk, max_chunk);
+    } else if (res == 20) {
+      auto k = candidates.begin ();
+      for (auto i = k; i != candidates.begin () + size; i++)
+        if (failed (-*i)) swap (*i, *k++);
+      const size_t core = k - candidates.begin ();
+      if (core == 1) {
+        backbone.push_back (candidates[0]);
+        candidates[0] = candidates.back ();
+        candidates.pop_back ();
+      } else if (core > 1) chunk = 1;
+      else break;               // Only user assumptions failed.
+    } else break;
+  }
+
+  reset_assumptions ();
+
+  if (complete) {
+    res = 10;
+    sort (backbone.begin (), backbone.end (),
+      [] (int a, int b) { return abs (a) < abs (b); });
+    VERBOSE (2, "found %zd backbone literals in %" PRId64 " calls",
+      backbone.size (), calls);
+  } else backbone.clear ();
+
+  return res;
+}
+
+}
@@ -101,7 +101,7 @@ void Internal::backtrack (int new_level) {
       assert (opts.chrono);
 #ifdef LOGGING
       if (!v.level) LOG ("reassign %d @ 0 unit clause %d", lit, lit);
-      else LOG (v.reason, "reassign %d @ %d", lit, v.level);
+      else LOG (reason (lit).clause, "reassign %d @ %d", lit, v.level);
 #endif
       trail[j] = lit;
       v.trail = j++;
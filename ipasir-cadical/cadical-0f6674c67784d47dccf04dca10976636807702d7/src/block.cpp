@@ -239,6 +239,15 @@ void Internal::block_pure_literal (Blocker & blocker, int lit)
 #ifndef NDEBUG
   for (const auto & c : nos) assert (c->garbage);
 #endif
+  // Clauses with internal only activation literals of contexts can not be
+  // pushed on the extension stack (see 'context.cpp').
+  //
+  for (const auto & c : pos)
+    if (!c->garbage && internal_only (c)) {
+      LOG (c, "pure literal %d in context clause", lit);
+      return;
+    }
+
   stats.blockpurelits++;
   LOG ("found pure literal %d", lit);
 
@@ -321,6 +330,7 @@ Internal::block_literal_with_one_negative_occ (Blocker & blocker, int lit)
     if (c->garbage) { j--; continue; }
     if (c->size > opts.blockmaxclslim) { skipped++; continue; }
     if (c->size < opts.blockminclslim) { skipped++; continue; }
+    if (internal_only (c)) { skipped++; continue; }
 
     LOG (c, "trying to block on %d", lit);
 
@@ -412,6 +422,7 @@ size_t Internal::block_candidates (Blocker & blocker, int lit) {
     assert (!c->redundant);
     if (c->size > opts.blockmaxclslim) continue;
     if (c->size < opts.blockminclslim) continue;
+    if (internal_only (c)) continue;
     const const_literal_iterator eoc = c->end ();
     const_literal_iterator l;
     for (l = c->begin (); l != eoc; l++) {
@@ -191,8 +191,11 @@ struct External;
 // Forward declaration of call-back classes. See bottom of this file.
 
 class Terminator;
+class Learner;
+class Importer;
 class ClauseIterator;
 class WitnessIterator;
+class Enumerator;
 
 /*------------------------------------------------------------------------*/
 
@@ -204,6 +207,11 @@ public:
 
   // This section implements the corresponding IPASIR functionality.
 
+  // Options start with their default values, which can be overwritten by
+  // environment variables, e.g., 'CADICAL_ELIM=0' disables 'elim'.  The
+  // environment is only read when the first solver of the process is
+  // created though.  Later changes of these variables have no effect.
+  //
   Solver ();
   ~Solver ();
 
@@ -271,8 +279,143 @@ public:
   void connect_terminator (Terminator * terminator);
   void disconnect_terminator ();
 
+  // Add call-back which receives learned clauses.  There can only be one
+  // learner be connected.  If a second (non-zero) one is added the first
+  // one is implicitly disconnected.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_learner (Learner * learner);
+  void disconnect_learner ();
+
   // ====== END IPASIR =====================================================
 
+  // Bulk version of 'add' which adds the 'size' literals in 'lits' in this
+  // order, as if 'add' was called for each of them.  The buffer may hold
+  // several clauses each terminated by a zero literal.  Adding a whole
+  // formula at once avoids the per call overhead of the API (and of any
+  // foreign function interface on top of it).  An empty buffer does not
+  // change the state.
+  //
+  //   require (VALID)
+  //   if (size && lits[size-1]) ensure (ADDING)
+  //   if (size && !lits[size-1]) ensure (UNKNOWN)
+  //
+  void add_clauses (const int * lits, int size);
+
+  // Bulk versions of 'val' for all variables 'idx' with 'first <= idx' and
+  // 'idx <= last', which write 'val (idx)' respectively its sign ('1' for
+  // true and '-1' for false) to 'values[idx - first]'.  The buffer has to
+  // provide space for 'last - first + 1' values.
+  //
+  //   require (SATISFIED)
+  //   ensure (SATISFIED)
+  //
+  void val_range (int first, int last, int * values);
+  void val_range (int first, int last, signed char * values);
+
+  // Bulk version of 'failed' which writes at most 'size' of the failed
+  // assumptions to 'core' in the order they were assumed and returns the
+  // number of all failed assumptions.  An assumption given several times is
+  // only written once.  A buffer with space for all assumptions is thus
+  // always large enough.
+  //
+  //   require (UNSATISFIED)
+  //   ensure (UNSATISFIED)
+  //
+  int failed_core (int * core, int size);
+
+  // Shrink the core of failed assumptions of the last 'solve' call by
+  // solving under subsets of it with at most 'shrinkcorelim' conflicts
+  // each.  Afterwards 'failed' and 'failed_core' only give the smaller core,
+  // which is returned.  If terminated, the core shrunken so far is kept.
+  // With option 'shrinkcore' this is done at the end of each unsatisfiable
+  // 'solve' call automatically.
+  //
+  //   require (UNSATISFIED)
+  //   ensure (UNSATISFIED)
+  //
+  int shrink_core ();
+
+  // Only propagate the 'size' literals in 'assumptions' (together with the
+  // literals assumed before through 'assume') without searching.  Writes at
+  // most 'capacity' of the implied literals, including the assumptions not
+  // fixed at the root level, to 'implied' in the order they were assigned
+  // and returns the number of all of them, or '-1' if propagation leads to
+  // a conflict.  Literals fixed at the root level are not included and
+  // neither are variables eliminated by earlier simplification unless they
+  // are frozen.  As with 'solve' all assumptions are reset afterwards.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN)
+  //
+  int propagate (const int * assumptions, int size,
+                 int * implied, int capacity);
+
+  // Compute the backbone, i.e., the literals true in all models, under the
+  // current assumptions (see 'assume') by solving incrementally.  Returns
+  // '10' and the backbone literals sorted by variable in 'backbone' if the
+  // formula is satisfiable, '20' if it is unsatisfiable under the
+  // assumptions (which then can be checked with 'failed') and zero if it
+  // was interrupted.  Afterwards all assumptions are reset.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN | UNSATISFIED)
+  //
+  int backbone (std::vector<int> & backbone);
+
+  // Enumerate the models of the formula under the current assumptions
+  // projected on the variables in 'projection' (all variables up to 'vars'
+  // if empty) by passing each projected model to 'enumerator'.  Models are
+  // given as literals in the order of 'projection' and each one is passed
+  // only once.  Enumeration stops after 'limit' models (if positive) or if
+  // 'enumerator' returns 'false'.  Returns '20' if all models have been
+  // enumerated, '10' if it stopped early and zero if it was interrupted.
+  // The blocking clauses are added to a temporary context (see 'push'),
+  // thus do not use any variable of the application and are removed at the
+  // end.  All assumptions are reset afterwards.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN)
+  //
+  int enumerate (Enumerator & enumerator,
+                 const std::vector<int> & projection, int64_t limit = 0);
+
+  // Open a new context.  All clauses added until the matching 'pop' belong
+  // to this context and are removed again by 'pop'.  Contexts nest and
+  // while open are implicitly assumed in every 'solve' and 'propagate'
+  // call.  Contexts use internal variables only, thus do not change 'vars'
+  // and 'traverse_clauses' and 'copy' give the clauses of open contexts as
+  // ordinary clauses.  Clauses of popped contexts are collected at the
+  // next 'solve' call after 'popcollect' (default 100) popped contexts.
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN)
+  //
+  void push ();
+
+  // Remove the clauses of the innermost context (see 'push').
+  //
+  //   require (READY)
+  //   ensure (UNKNOWN)
+  //
+  void pop ();
+
+  // Add call-back which is polled before the search starts and on restarts
+  // for clauses to be added as redundant clauses, e.g., clauses learned by
+  // other solvers working on the same formula.  There can only be one
+  // importer be connected.  If a second (non-zero) one is added the first
+  // one is implicitly disconnected.  Imported clauses can not be checked,
+  // thus importing is not possible while proofs are traced or checked (the
+  // importer is not polled if proof tracing or checking starts later).
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void connect_importer (Importer * importer);
+  void disconnect_importer ();
+
   // Return the current state of the solver as defined above.
   //
   const State & state () const { return _state; }
@@ -309,12 +452,26 @@ public:
   // sure that at least 'min_max_var' variables are initialized.  Since it
   // might need to reallocate tables, it destroys a satisfying assignment
   // and has the same state transition and conditions as 'assume' etc.
+  // With the 'sparse' option set only the maximum index is increased and
+  // variables are initialized on their first use.
   //
   //   require (READY)
   //   ensure (UNKNOWN)
   //
   void reserve (int min_max_var);
 
+  // Reset the solver to the state right after initialization, i.e., remove
+  // all variables, clauses and assumptions, disconnect all call-backs and
+  // stop proof tracing, which has the same effect as deleting the solver
+  // and creating a new one.  However, the memory allocated for variables
+  // is reused and option values (as well as the prefix) are kept unless
+  // 'keep_options' is false.  Options can be set afterwards again.
+  //
+  //   require (VALID)
+  //   ensure (CONFIGURING)
+  //
+  void reset (bool keep_options = true);
+
   //------------------------------------------------------------------------
   // This function can be used to write API calls to a file.  The same
   // format is used which 'mobical' can read, execute and also shrink
@@ -695,6 +852,10 @@ private:
   //
   int call_external_solve_and_check_results ();
 
+  // Cube-and-conquer on copies of this solver before 'solve'.
+  //
+  void conquer ();
+
   //------------------------------------------------------------------------
   // Print DIMACS file to '<stdout>' for debugging and testing purposes,
   // including derived units and assumptions.  Since it will print in terms
@@ -718,6 +879,41 @@ public:
   virtual bool terminate () = 0;
 };
 
+// Connected learners are asked for every learned clause through 'learning'
+// whether they want to receive it, given its size and glue (the number of
+// decision levels in the clause, zero for the empty clause).  Only if this
+// returns 'true' the literals of the clause are passed to 'learn' one by
+// one, followed by a terminating zero literal.
+
+class Learner {
+public:
+  virtual ~Learner () { }
+  virtual bool learning (int size, int glue) = 0;
+  virtual void learn (int lit) = 0;
+};
+
+// Connected importers return a buffer of 'size' literals forming zero
+// terminated clauses (as in 'add_clauses') or set 'size' to zero if there
+// is nothing to import.  The buffer only has to stay valid until the next
+// call.  The clauses have to be implied by the formula.  Clauses with
+// variables which are unknown or not active in the solver are ignored.
+
+class Importer {
+public:
+  virtual ~Importer () { }
+  virtual const int * import (size_t & size) = 0;
+};
+
+// Connected enumerators get each model found in 'enumerate' and return
+// 'false' if enumeration should stop.  The model is only valid during the
+// call.
+
+class Enumerator {
+public:
+  virtual ~Enumerator () { }
+  virtual bool model (const std::vector<int> & model) = 0;
+};
+
 /*------------------------------------------------------------------------*/
 
 // Allows to traverse all remaining irredundant clauses.  Satisfied and
@@ -1,16 +1,221 @@
 #include "cadical.hpp"
+#include "tiny.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <mutex>
+#include <vector>
 
 namespace CaDiCaL {
 
-struct Wrapper : Terminator {
+struct Wrapper : Terminator, Learner, Importer {
+
   Solver * solver;
+
+  // Tiny formulas are kept in 'tiny' instead of 'solver' as long as they
+  // fit (see 'tiny.hpp').  It is created by the first 'add' or 'assume'
+  // unless 'tiny_enabled' was cleared before.  All functions not supported
+  // by 'tiny' go through 'full', which moves the formula to 'solver' and
+  // disables 'tiny' until the next 'reset'.
+
+  Tiny * tiny;
+  bool tiny_enabled;
+
   void * state;
   int (*function) (void *);
-  bool terminate () { return function ? function (state) : false; }
-  Wrapper () : solver (new Solver ()), state (0), function (0) { }
-  ~Wrapper () { function = 0; delete solver; }
+
+  // The terminate call-back 'function' is only polled after 'period'
+  // checks of the solver or if 'interval' seconds passed since the last
+  // poll (zero disables the respective condition).  By default it is polled
+  // on every check, which happens at least once per conflict.
+
+  struct {
+    int64_t period, checked;
+    double interval, polled;
+  } polling;
+
+  // As long as the formula is not moved to 'solver', 'ccadical_terminate'
+  // only sets 'interrupted', which is checked by 'tiny' and cleared at the
+  // end of its 'solve' as 'solver' does for forced termination.  Otherwise
+  // a forced termination of 'solver' would be left over for the first
+  // 'solve' of 'solver', i.e., the one reproducing the result of 'tiny' in
+  // 'full'.  Afterwards pending interrupts are forwarded to 'solver'.
+
+  std::atomic<bool> interrupted, deferring;
+
+  void forward () {
+    deferring = false;
+    if (interrupted.exchange (false)) solver->terminate ();
+  }
+
+  // Learned clauses are collected in 'learned'.  They are either passed on
+  // one by one to 'learn' as soon they are complete, or to 'learn_batch'
+  // as soon the buffer holds at least 'batch_size' literals and before
+  // 'solve' returns.  This saves calls through foreign function interfaces.
+  // After being flushed the buffer is reused without reallocation.
+
+  static const size_t batch_size = 1 << 12;
+
+  struct {
+    void * state;
+    int max_length, max_glue;
+    void (*learn) (void *, int *);
+    void (*learn_batch) (void *, const int *, int);
+  } learner;
+  std::vector<int> learned;
+
+  struct {
+    void * state;
+    const int * (*import) (void *, int *);
+  } importer;
+
+  bool terminate () {
+    if (!function) return false;
+    bool due = polling.period > 0 && ++polling.checked >= polling.period;
+    double now = 0;
+    if (polling.interval > 0) {
+      using namespace std::chrono;
+      now = duration<double> (steady_clock::now ().time_since_epoch ())
+        .count ();
+      if (now - polling.polled >= polling.interval) due = true;
+    }
+    if (!due) return false;
+    polling.checked = 0;
+    polling.polled = now;
+    return function (state);
+  }
+
+  bool learning (int size, int glue) {
+    return size <= learner.max_length && glue <= learner.max_glue;
+  }
+
+  void learn (int lit) {
+    learned.push_back (lit);
+    if (lit) return;
+    if (learner.learn) {
+      learner.learn (learner.state, learned.data ());
+      learned.clear ();
+    } else if (learned.size () >= batch_size) flush ();
+  }
+
+  const int * import (size_t & size) {
+    int tmp = 0;
+    const int * res = importer.import (importer.state, &tmp);
+    size = tmp > 0 ? tmp : 0;
+    return res;
+  }
+
+  void flush () {
+    if (learned.empty ()) return;
+    if (learner.learn_batch)
+      learner.learn_batch (learner.state,
+                           learned.data (), (int) learned.size ());
+    learned.clear ();
+  }
+
+  void connect (void * state, int max_length, int max_glue,
+                void (*learn) (void *, int *),
+                void (*learn_batch) (void *, const int *, int)) {
+    flush ();
+    learner.state = state;
+    learner.max_length = max_length;
+    learner.max_glue = max_glue;
+    learner.learn = learn;
+    learner.learn_batch = learn_batch;
+    if (learn || learn_batch) {
+      learned.reserve (batch_size);
+      full ()->connect_learner (this);
+    } else solver->disconnect_learner ();
+  }
+
+  Tiny * fast () {
+    if (!tiny && tiny_enabled) {
+      tiny_enabled = false;
+      if (solver->get ("tiny")) {
+        tiny = new Tiny (solver->get ("tinyvars"),
+                         solver->get ("tinyclauses"),
+                         solver->get ("tinyeffort"));
+        tiny->interrupted = &interrupted;
+        tiny->terminator = this;
+      }
+    }
+    return tiny;
+  }
+
+  // Replays the formula and assumptions of 'tiny' and reproduces the result
+  // of its last 'solve' call, such that for instance 'val' and 'failed'
+  // work as expected afterwards.  To reproduce a model all its literals
+  // are assumed, which does not need any search.
+
+  Solver * full () {
+    tiny_enabled = false;
+    if (!tiny) {
+      if (deferring) forward ();
+      return solver;
+    }
+    for (const auto & lit : tiny->literals) solver->add (lit);
+    if (tiny->result) {
+      if (function) solver->disconnect_terminator ();
+      if (tiny->result == 10)
+        for (int idx = 1; idx <= tiny->max_var; idx++)
+          solver->assume (tiny->val (idx));
+      const int res = solver->solve ();
+      assert (res == tiny->result), (void) res;
+      if (function) solver->connect_terminator (this);
+    }
+    for (const auto & lit : tiny->assumptions) solver->assume (lit);
+    delete tiny;
+    tiny = 0;
+    forward ();
+    return solver;
+  }
+
+  // Options can only be set before adding clauses and thus 'tiny' only has
+  // to be dropped if it already holds some, to trigger the same errors.
+
+  Solver * configure () { return tiny ? full () : solver; }
+
+  void init () {
+    tiny_enabled = true;
+    interrupted = false;
+    deferring = true;
+    state = 0;
+    function = 0;
+    memset (&learner, 0, sizeof learner);
+    memset (&importer, 0, sizeof importer);
+    memset (&polling, 0, sizeof polling);
+    polling.period = 1;
+    learned.clear ();
+  }
+
+  void reset (bool keep_options) {
+    delete tiny;
+    tiny = 0;
+    init ();
+    solver->reset (keep_options);
+  }
+
+  Wrapper () : solver (new Solver ()), tiny (0) { init (); }
+  ~Wrapper () { function = 0; delete tiny; delete solver; }
 };
 
+// Released solvers are reset and kept for reuse by 'ccadical_init' in this
+// pool, which holds at most 'size' solvers (none by default).  Since reset
+// solvers reuse their variable tables, this avoids most allocations for
+// applications using many solvers on small formulas one after the other.
+
+struct Pool {
+  std::mutex lock;
+  std::vector<Wrapper *> wrappers;
+  size_t size = 0;
+  ~Pool () { for (const auto & wrapper : wrappers) delete wrapper; }
+};
+
+static Pool pool;
+
 }
 
 using namespace CaDiCaL;
@@ -24,69 +229,248 @@ const char * ccadical_signature (void) {
 }
 
 CCaDiCaL * ccadical_init (void) {
+  {
+    std::lock_guard<std::mutex> guard (pool.lock);
+    if (!pool.wrappers.empty ()) {
+      Wrapper * wrapper = pool.wrappers.back ();
+      pool.wrappers.pop_back ();
+      return (CCaDiCaL*) wrapper;
+    }
+  }
   return (CCaDiCaL*) new Wrapper ();
 }
 
-void ccadical_release (CCaDiCaL * wrapper) {
-  delete (Wrapper*) wrapper;
+void ccadical_release (CCaDiCaL * ptr) {
+  Wrapper * wrapper = (Wrapper*) ptr;
+  bool keep;
+  {
+    std::lock_guard<std::mutex> guard (pool.lock);
+    keep = pool.wrappers.size () < pool.size;
+  }
+  if (keep) {
+    wrapper->reset (false);
+    std::lock_guard<std::mutex> guard (pool.lock);
+    if (pool.wrappers.size () < pool.size) {
+      pool.wrappers.push_back (wrapper);
+      return;
+    }
+  }
+  delete wrapper;
+}
+
+void ccadical_clear (CCaDiCaL * wrapper) {
+  ((Wrapper*) wrapper)->reset (true);
+}
+
+void ccadical_pool (int size) {
+  std::vector<Wrapper *> deleted;
+  {
+    std::lock_guard<std::mutex> guard (pool.lock);
+    pool.size = size > 0 ? size : 0;
+    while (pool.wrappers.size () > pool.size) {
+      deleted.push_back (pool.wrappers.back ());
+      pool.wrappers.pop_back ();
+    }
+  }
+  for (const auto & wrapper : deleted) delete wrapper;
 }
 
 void ccadical_set_option (CCaDiCaL * wrapper,
                           const char * name, int val) {
-  ((Wrapper*) wrapper)->solver->set (name, val);
+  ((Wrapper*) wrapper)->configure ()->set (name, val);
+}
+
+int ccadical_set_long_option (CCaDiCaL * wrapper, const char * arg) {
+  return ((Wrapper*) wrapper)->configure ()->set_long_option (arg);
+}
+
+int ccadical_configure (CCaDiCaL * wrapper, const char * name) {
+  return ((Wrapper*) wrapper)->configure ()->configure (name);
 }
 
 void ccadical_limit (CCaDiCaL * wrapper,
                      const char * name, int val) {
-  ((Wrapper*) wrapper)->solver->limit (name, val);
+  ((Wrapper*) wrapper)->full ()->limit (name, val);
 }
 
 int ccadical_get_option (CCaDiCaL * wrapper, const char * name) {
   return ((Wrapper*) wrapper)->solver->get (name);
 }
 
-void ccadical_add (CCaDiCaL * wrapper, int lit) {
-  ((Wrapper*) wrapper)->solver->add (lit);
+void ccadical_add (CCaDiCaL * ptr, int lit) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  Tiny * tiny = wrapper->fast ();
+  if (!tiny || !tiny->add (lit)) wrapper->full ()->add (lit);
+}
+
+// A negative 'size' is passed on to the solver to report the error.
+
+void ccadical_add_clauses (CCaDiCaL * ptr, const int * lits, int size) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  Tiny * tiny = wrapper->fast ();
+  int i = 0;
+  while (tiny && i < size && tiny->add (lits[i])) i++;
+  if (!tiny || i != size) wrapper->full ()->add_clauses (lits + i, size - i);
+}
+
+void ccadical_assume (CCaDiCaL * ptr, int lit) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  Tiny * tiny = wrapper->fast ();
+  if (!tiny || !tiny->assume (lit)) wrapper->full ()->assume (lit);
 }
 
-void ccadical_assume (CCaDiCaL * wrapper, int lit) {
-  ((Wrapper*) wrapper)->solver->assume (lit);
+int ccadical_solve (CCaDiCaL * ptr) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  Tiny * tiny = wrapper->tiny;
+  if (tiny) {
+    const int res = tiny->solve ();
+    if (res || tiny->terminated) {
+      wrapper->interrupted = false;
+      return res;
+    }
+  }
+  int res = wrapper->full ()->solve ();
+  wrapper->flush ();
+  return res;
+}
+
+int ccadical_simplify (CCaDiCaL * ptr) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  int res = wrapper->full ()->simplify ();
+  wrapper->flush ();
+  return res;
+}
+
+// Values are taken from 'tiny' if it found the model and the arguments are
+// valid, otherwise the solver produces the same result or error message.
+
+static Tiny * model (Wrapper * wrapper) {
+  Tiny * tiny = wrapper->tiny;
+  return tiny && tiny->result == 10 ? tiny : 0;
 }
 
-int ccadical_solve (CCaDiCaL * wrapper) {
-  return ((Wrapper*) wrapper)->solver->solve ();
+int ccadical_val (CCaDiCaL * ptr, int lit) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  Tiny * tiny = model (wrapper);
+  if (tiny && lit && lit != INT_MIN) return tiny->val (lit);
+  return wrapper->full ()->val (lit);
 }
 
-int ccadical_simplify (CCaDiCaL * wrapper) {
-  return ((Wrapper*) wrapper)->solver->simplify ();
+void ccadical_val_range (CCaDiCaL * ptr,
+                         int first, int last, int * vals) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  Tiny * tiny = model (wrapper);
+  if (tiny && first > 0 && first - 1 <= last && (vals || first > last))
+    for (int idx = first; idx <= last; idx++) *vals++ = tiny->val (idx);
+  else wrapper->full ()->val_range (first, last, vals);
 }
 
-int ccadical_val (CCaDiCaL * wrapper, int lit) {
-  return ((Wrapper*) wrapper)->solver->val (lit);
+void ccadical_model (CCaDiCaL * ptr,
+                     int first, int last, signed char * vals) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  Tiny * tiny = model (wrapper);
+  if (tiny && first > 0 && first - 1 <= last && (vals || first > last))
+    for (int idx = first; idx <= last; idx++)
+      *vals++ = tiny->val (idx) < 0 ? -1 : 1;
+  else wrapper->full ()->val_range (first, last, vals);
 }
 
 int ccadical_failed (CCaDiCaL * wrapper, int lit) {
-  return ((Wrapper*) wrapper)->solver->failed (lit);
+  return ((Wrapper*) wrapper)->full ()->failed (lit);
+}
+
+int ccadical_failed_core (CCaDiCaL * wrapper, int * core, int size) {
+  return ((Wrapper*) wrapper)->full ()->failed_core (core, size);
+}
+
+int ccadical_shrink_core (CCaDiCaL * wrapper) {
+  return ((Wrapper*) wrapper)->full ()->shrink_core ();
+}
+
+int ccadical_propagate (CCaDiCaL * wrapper,
+                        const int * assumptions, int size,
+                        int * implied, int capacity) {
+  return ((Wrapper*) wrapper)->full ()->propagate (assumptions, size,
+                                                  implied, capacity);
+}
+
+// Returns the number of backbone literals of which at most 'size' are
+// written to 'backbone', or '-1' if unsatisfiable and '-2' if interrupted.
+
+int ccadical_backbone (CCaDiCaL * wrapper, int * backbone, int size) {
+  std::vector<int> literals;
+  const int res = ((Wrapper*) wrapper)->full ()->backbone (literals);
+  if (res == 20) return -1;
+  if (res != 10) return -2;
+  for (int i = 0; i < size && i < (int) literals.size (); i++)
+    backbone[i] = literals[i];
+  return (int) literals.size ();
+}
+
+// Models are collected in a buffer of zero terminated models, which is
+// passed on to 'models' as soon it holds at least 'batch_size' literals
+// and at the end, as for 'learn_batch'.
+
+struct Models : Enumerator {
+  void * state;
+  void (*models) (void *, const int *, int);
+  std::vector<int> buffer;
+  bool model (const std::vector<int> & model) {
+    buffer.insert (buffer.end (), model.begin (), model.end ());
+    buffer.push_back (0);
+    if (buffer.size () >= Wrapper::batch_size) flush ();
+    return true;
+  }
+  void flush () {
+    if (buffer.empty ()) return;
+    models (state, buffer.data (), (int) buffer.size ());
+    buffer.clear ();
+  }
+};
+
+int ccadical_enumerate (CCaDiCaL * wrapper,
+                        const int * projection, int size,
+                        int64_t limit, void * state,
+                        void (*models)(void *, const int *, int)) {
+  Models enumerator;
+  enumerator.state = state;
+  enumerator.models = models;
+  enumerator.buffer.reserve (Wrapper::batch_size);
+  std::vector<int> vars (projection, projection + size);
+  const int res =
+    ((Wrapper*) wrapper)->full ()->enumerate (enumerator, vars, limit);
+  enumerator.flush ();
+  return res;
+}
+
+void ccadical_push (CCaDiCaL * wrapper) {
+  ((Wrapper*) wrapper)->full ()->push ();
+}
+
+void ccadical_pop (CCaDiCaL * wrapper) {
+  ((Wrapper*) wrapper)->full ()->pop ();
 }
 
 void ccadical_print_statistics (CCaDiCaL * wrapper) {
-  ((Wrapper*) wrapper)->solver->statistics ();
+  ((Wrapper*) wrapper)->full ()->statistics ();
 }
 
-void ccadical_terminate (CCaDiCaL * wrapper) {
-  ((Wrapper*) wrapper)->solver->terminate ();
+void ccadical_terminate (CCaDiCaL * ptr) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  wrapper->interrupted = true;
+  if (!wrapper->deferring) wrapper->solver->terminate ();
 }
 
 int64_t ccadical_active (CCaDiCaL * wrapper) {
-  return ((Wrapper*) wrapper)->solver->active ();
+  return ((Wrapper*) wrapper)->full ()->active ();
 }
 
 int64_t ccadical_irredundant (CCaDiCaL * wrapper) {
-  return ((Wrapper*) wrapper)->solver->irredundant ();
+  return ((Wrapper*) wrapper)->full ()->irredundant ();
 }
 
 int ccadical_fixed (CCaDiCaL * wrapper, int lit) {
-  return ((Wrapper*) wrapper)->solver->fixed (lit);
+  return ((Wrapper*) wrapper)->full ()->fixed (lit);
 }
 
 void ccadical_set_terminate (CCaDiCaL * ptr,
@@ -98,16 +482,48 @@ void ccadical_set_terminate (CCaDiCaL * ptr,
   else wrapper->solver->disconnect_terminator ();
 }
 
+void ccadical_set_terminate_interval (CCaDiCaL * ptr,
+                                      int checks, int milliseconds) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  wrapper->polling.period = checks > 0 ? checks : 0;
+  wrapper->polling.interval = milliseconds > 0 ? milliseconds / 1e3 : 0;
+  wrapper->polling.checked = 0;
+}
+
+void ccadical_set_learn (CCaDiCaL * ptr,
+                         void * state, int max_length,
+                         void (*learn)(void * state, int * clause)) {
+  ((Wrapper*) ptr)->connect (state, max_length, INT_MAX, learn, 0);
+}
+
+void ccadical_set_learn_batch (CCaDiCaL * ptr,
+                               void * state, int max_length, int max_glue,
+                               void (*learn)(void * state,
+                                             const int * clauses,
+                                             int size)) {
+  ((Wrapper*) ptr)->connect (state, max_length, max_glue, 0, learn);
+}
+
+void ccadical_set_import (CCaDiCaL * ptr,
+                          void * state,
+                          const int * (*import)(void * state, int * size)) {
+  Wrapper * wrapper = (Wrapper *) ptr;
+  wrapper->importer.state = state;
+  wrapper->importer.import = import;
+  if (import) wrapper->full ()->connect_importer (wrapper);
+  else wrapper->solver->disconnect_importer ();
+}
+
 void ccadical_freeze (CCaDiCaL * ptr, int lit) {
-  ((Wrapper*) ptr)->solver->freeze (lit);
+  ((Wrapper*) ptr)->full ()->freeze (lit);
 }
 
 void ccadical_melt (CCaDiCaL * ptr, int lit) {
-  ((Wrapper*) ptr)->solver->melt (lit);
+  ((Wrapper*) ptr)->full ()->melt (lit);
 }
 
 int ccadical_frozen (CCaDiCaL * ptr, int lit) {
-  return ((Wrapper*) ptr)->solver->frozen (lit);
+  return ((Wrapper*) ptr)->full ()->frozen (lit);
 }
 
 }
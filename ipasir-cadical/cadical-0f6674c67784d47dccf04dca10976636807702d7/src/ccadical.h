@@ -25,12 +25,38 @@ int ccadical_failed (CCaDiCaL *, int lit);
 
 void ccadical_set_terminate (CCaDiCaL *,
   void * state, int (*terminate)(void * state));
+void ccadical_set_learn (CCaDiCaL *,
+  void * state, int max_length, void (*learn)(void * state, int * clause));
 
 /*------------------------------------------------------------------------*/
 
 // Non-IPASIR conformant 'C' functions.
 
+void ccadical_add_clauses (CCaDiCaL *, const int * lits, int size);
+void ccadical_val_range (CCaDiCaL *, int first, int last, int * vals);
+void ccadical_model (CCaDiCaL *, int first, int last, signed char * vals);
+int ccadical_failed_core (CCaDiCaL *, int * core, int size);
+int ccadical_shrink_core (CCaDiCaL *);
+int ccadical_propagate (CCaDiCaL *, const int * assumptions, int size,
+                       int * implied, int capacity);
+int ccadical_backbone (CCaDiCaL *, int * backbone, int size);
+int ccadical_enumerate (CCaDiCaL *, const int * projection, int size,
+  int64_t limit, void * state,
+  void (*models)(void * state, const int * models, int size));
+void ccadical_push (CCaDiCaL *);
+void ccadical_pop (CCaDiCaL *);
+void ccadical_clear (CCaDiCaL *);
+void ccadical_pool (int size);
+void ccadical_set_learn_batch (CCaDiCaL *,
+  void * state, int max_length, int max_glue,
+  void (*learn)(void * state, const int * clauses, int size));
+void ccadical_set_import (CCaDiCaL *,
+  void * state, const int * (*import)(void * state, int * size));
+void ccadical_set_terminate_interval (CCaDiCaL *,
+  int checks, int milliseconds);
 void ccadical_set_option (CCaDiCaL *, const char * name, int val);
+int ccadical_set_long_option (CCaDiCaL *, const char * arg);
+int ccadical_configure (CCaDiCaL *, const char * name);
 void ccadical_limit (CCaDiCaL *, const char * name, int limit);
 int ccadical_get_option (CCaDiCaL *, const char * name);
 void ccadical_print_statistics (CCaDiCaL *);
@@ -84,7 +84,13 @@ Clause * Internal::new_clause (bool red, int glue) {
   else keep = false;
 
   size_t bytes = sizeof (Clause) + (size - 2) * sizeof (int);
-  Clause * c = (Clause *) new char[bytes];
+#ifndef WATCH32
+  Clause * c = 0;
+  if (red && opts.arenanursery) c = (Clause *) arena.allocate (bytes);
+  if (!c) c = (Clause *) new char[bytes];
+#else
+  Clause * c = (Clause *) arena.allocate (bytes);
+#endif
 
   stats.added.total++;
 #ifdef LOGGING
@@ -194,14 +200,19 @@ size_t Internal::shrink_clause (Clause * c, int new_size) {
 }
 
 // This is the 'raw' deallocation of a clause.  If the clause is in the
-// arena nothing happens.  If the clause is not in the arena its memory is
-// reclaimed immediately.
+// arena (or its nursery) nothing happens.  If the clause is not in the
+// arena its memory is reclaimed immediately.  With '-DWATCH32' all clauses
+// are in the arena.
 
 void Internal::deallocate_clause (Clause * c) {
+#ifndef WATCH32
   char * p = (char*) c;
-  if (arena.contains (p)) return;
+  if (arena.contains (p) || arena.nursery_contains (p)) return;
   LOG (c, "deallocate");
   delete [] p;
+#else
+  (void) c;
+#endif
 }
 
 void Internal::delete_clause (Clause * c) {
@@ -283,7 +294,7 @@ void Internal::assign_original_unit (int lit) {
   Var & v = var (idx);
   v.level = level;
   v.trail = (int) trail.size ();
-  v.reason = 0;
+  rtab[idx].clause = 0;
   const signed_char tmp = sign (lit);
   vals[idx] = tmp;
   vals[-idx] = -tmp;
@@ -368,6 +379,8 @@ Clause * Internal::new_learned_redundant_clause (int glue) {
     assert (var (clause[1]).level >= var (clause[i]).level);
 #endif
   external->check_learned_clause ();
+  if (external->learner)
+    external->export_learned_large_clause (clause, glue);
   Clause * res = new_clause (true, glue);
   if (proof) proof->add_derived_clause (res);
   assert (watching ());
@@ -103,29 +103,30 @@ size_t Internal::flush_occs (int lit) {
 // 'reduce' where we watch and no occurrence lists.  We have to protect
 // reason clauses not be collected and thus we have this additional check
 // hidden in 'Clause.collect', which for the root level context of
-// preprocessing is actually redundant.
+// preprocessing is actually redundant.  Long clauses which were shrunken
+// to binary clauses are moved to the binary watches here.
 
-inline void Internal::flush_watches (int lit, Watches & saved) {
-  assert (saved.empty ());
+inline void Internal::flush_watches (int lit) {
+  Watches & bs = binaries (lit);
   Watches & ws = watches (lit);
-  const const_watch_iterator end = ws.end ();
-  watch_iterator j = ws.begin ();
-  const_watch_iterator i;
-  for (i = j; i != end; i++) {
-    Watch w = *i;
-    Clause * c = w.clause;
-    if (c->collect ()) continue;
-    if (c->moved) c = w.clause = c->copy;
-    w.size = c->size;
-    const int new_blit_pos = (c->literals[0] == lit);
-    assert (c->literals[!new_blit_pos] == lit);
-    w.blit = c->literals[new_blit_pos];
-    if (w.binary ()) *j++ = w;
-    else saved.push_back (w);
+  for (int binary = 1; binary >= 0; binary--) {
+    Watches & flushed = binary ? bs : ws;
+    const const_watch_iterator end = flushed.end ();
+    watch_iterator j = flushed.begin ();
+    const_watch_iterator i;
+    for (i = j; i != end; i++) {
+      Clause * c = i->clause;
+      if (c->collect ()) continue;
+      if (c->moved) c = c->copy;
+      const int new_blit_pos = (c->literals[0] == lit);
+      assert (c->literals[!new_blit_pos] == lit);
+      const Watch w (c->literals[new_blit_pos], c);
+      if (binary || !w.binary ()) *j++ = w;
+      else bs.push_back (w);
+    }
+    flushed.resize (j - flushed.begin ());
   }
-  ws.resize (j - ws.begin ());
-  for (const auto & w : saved) ws.push_back (w);
-  saved.clear ();
+  shrink_vector (bs);
   shrink_vector (ws);
 }
 
@@ -134,11 +135,9 @@ void Internal::flush_all_occs_and_watches () {
     for (int idx = 1; idx <= max_var; idx++)
       flush_occs (idx), flush_occs (-idx);
 
-  if (watching ()) {
-    Watches tmp;
+  if (watching ())
     for (int idx = 1; idx <= max_var; idx++)
-      flush_watches (idx, tmp), flush_watches (-idx, tmp);
-  }
+      flush_watches (idx), flush_watches (-idx);
 }
 
 /*------------------------------------------------------------------------*/
@@ -187,12 +186,12 @@ void Internal::copy_clause (Clause * c) {
   LOG ("copied clause[%p] to clause[%p]", c, d);
   if (d->reason) {
     assert (level > 0);
-    Var & v = var (d->literals[0]);
-    if (v.reason == c) v.reason = d;
+    Reason & r = reason (d->literals[0]);
+    if (r.clause == c) r.clause = d;
     else {
-      Var & u = var (d->literals[1]);
-      assert (u.reason == c);
-      u.reason = d;
+      Reason & s = reason (d->literals[1]);
+      assert (s.clause == c);
+      s.clause = d;
     }
   }
   c->moved = true;
@@ -256,9 +255,11 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (int idx = 1; idx <= max_var; idx++)
-        for (const auto & w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        for (int binary = 1; binary >= 0; binary--)
+          for (const auto & w : binary ? binaries (sign * likely_phase (idx))
+                                       : watches (sign * likely_phase (idx)))
+            if (!w.clause->moved && !w.clause->collect ())
+              copy_clause (w.clause);
 
   } else {
 
@@ -272,9 +273,11 @@ void Internal::copy_non_garbage_clauses () {
 
     for (int sign = -1; sign <= 1; sign += 2)
       for (int idx = queue.last; idx; idx = link (idx).prev)
-        for (const auto & w : watches (sign * likely_phase (idx)))
-          if (!w.clause->moved && !w.clause->collect ())
-            copy_clause (w.clause);
+        for (int binary = 1; binary >= 0; binary--)
+          for (const auto & w : binary ? binaries (sign * likely_phase (idx))
+                                       : watches (sign * likely_phase (idx)))
+            if (!w.clause->moved && !w.clause->collect ())
+              copy_clause (w.clause);
   }
 
   // Do not forget to move clauses which are not watched, which happened in
@@ -339,8 +342,14 @@ void Internal::check_clause_stats () {
 
 /*------------------------------------------------------------------------*/
 
+// With '-DWATCH32' clauses are only reclaimed by the moving collector.
+
 bool Internal::arenaing () {
+#ifdef WATCH32
+  return true;
+#else
   return opts.arena && (stats.collections > 1);
+#endif
 }
 
 void Internal::garbage_collection () {
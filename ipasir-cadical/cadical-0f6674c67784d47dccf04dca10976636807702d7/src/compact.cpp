@@ -54,11 +54,22 @@ struct Mapper {
 
     assert (!internal->level);
 
-    for (int src = 1; src <= internal->max_var; src++) {
+    // Fixed external variables are mapped to the first fixed variable,
+    // which thus should not be an internal only activation variable.
+    //
+    const int max_var = internal->max_var;
+    for (int src = 1; !first_fixed && src <= max_var; src++)
+      if (internal->flags (src).fixed () && !internal->internal_only (src))
+        first_fixed = src;
+    for (int src = 1; !first_fixed && src <= max_var; src++)
+      if (internal->flags (src).fixed ())
+        first_fixed = src;
+
+    for (int src = 1; src <= max_var; src++) {
       const Flags & f = internal->flags (src);
       if (f.active ()) table[src] = ++new_max_var;
-      else if (f.fixed () && !first_fixed)
-        table[first_fixed = src] = map_first_fixed = ++new_max_var;
+      else if (src == first_fixed)
+        table[src] = map_first_fixed = ++new_max_var;
     }
 
     first_fixed_val = first_fixed ? internal->val (first_fixed) : 0;
@@ -181,8 +192,10 @@ void Internal::compact () {
       sign (mapper.first_fixed_val)*mapper.first_fixed);
   else LOG ("no variable fixed");
 
-  if (!assumptions.empty ()) {
-    assert (!external->assumptions.empty ());
+  const bool reassume = !assumptions.empty ();
+  if (reassume) {
+    assert (!external->assumptions.empty () ||
+            !external->contexts.empty ());
     LOG ("temporarily reset internal assumptions");
     reset_assumptions ();
   }
@@ -193,13 +206,23 @@ void Internal::compact () {
 
   // Flush the external indices.  This has to occur before we map 'vals'.
   //
-  for (int eidx = 1; eidx <= external->max_var; eidx++) {
-    int src = external->e2i[eidx], dst;
+  Paged<int> & e2i = external->e2i;
+  for (int eidx = 1; eidx <= external->max_var; eidx = e2i.next (eidx)) {
+    int src = e2i[eidx], dst;
     if (!src) continue;
     dst = mapper.map_lit (src);
     LOG ("compact %" PRId64 " maps external %d to internal %d from internal %d",
       stats.compacts, eidx, dst, src);
-    external->e2i[eidx] = dst;
+    e2i.ref (eidx) = dst;
+  }
+
+  // Map the internal only activation literals of open contexts.
+  //
+  for (auto & act : external->contexts) {
+    const int dst = mapper.map_lit (act);
+    LOG ("compact %" PRId64 " maps activation literal %d to %d",
+      stats.compacts, act, dst);
+    act = dst;
   }
 
   // Map the literals in all clauses.
@@ -220,8 +243,9 @@ void Internal::compact () {
   if (!wtab.empty ())
     for (int idx = 1; idx <= max_var; idx++)
       for (int sign = -1; sign <= 1; sign += 2)
-        for (auto & w : watches (sign*idx))
-          w.blit = mapper.map_lit (w.blit);
+        for (int binary = 1; binary >= 0; binary--)
+          for (auto & w : binary ? binaries (sign*idx) : watches (sign*idx))
+            w.blit = mapper.map_lit (w.blit);
 
   // We first flush inactive variables and map the links in the queue.  This
   // has to be done before we map the actual links data structure 'links'.
@@ -304,6 +328,12 @@ void Internal::compact () {
       external->assumptions.size ());
   }
 
+  // Activation literals of open contexts are assumed internally only.
+  //
+  if (reassume)
+    for (const auto & act : external->contexts)
+      assume (act);
+
   // Special case for 'val' as for 'val' we trade branch less code for
   // memory and always allocated an [-maxvar,...,maxvar] array.
   {
@@ -324,9 +354,11 @@ void Internal::compact () {
   mapper.map_vector (btab);
   mapper.map_vector (links);
   mapper.map_vector (vtab);
+  mapper.map_vector (rtab);
   if (!ntab.empty ()) mapper.map2_vector (ntab);
   if (!ntab2.empty ()) mapper.map_vector (ntab2);
   if (!wtab.empty ()) mapper.map2_vector (wtab);
+  if (!bwtab.empty ()) mapper.map2_vector (bwtab);
   if (!otab.empty ()) mapper.map2_vector (otab);
   if (!big.empty ()) mapper.map2_vector (big);
 
@@ -0,0 +1,100 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Contexts ('Solver::push' and 'Solver::pop') group clauses which can be
+// removed again.  Each open context has an activation literal 'act' of a
+// new internal variable, which is frozen while the context is open but not
+// mapped to an external variable ('i2e' maps it to zero).  Thus it neither
+// takes a variable index from the application nor grows 'e2i'.  All
+// clauses added while contexts are open get '-act' of the innermost
+// context added and all activation literals of open contexts are assumed
+// in every 'solve' and 'propagate' call (but are never reported as failed
+// or implied).  Popping a context adds the unit clause '-act' and melts
+// 'act', which satisfies all clauses of the context, including learned
+// clauses depending on them, since those contain '-act' too.
+//
+// Since activation literals have no external variable, clauses containing
+// them are neither traced in proofs nor exported to the learner, nor can
+// they be moved to the extension stack.  Variable elimination, blocked and
+// covered clause elimination thus skip them.  In 'traverse_clauses' the
+// clauses of open contexts are given without activation literals.
+//
+// Satisfied clauses are only removed during garbage collection and fixed
+// internal variables only during compaction, which both are scheduled
+// in terms of conflicts.  Applications pushing and popping many contexts
+// in fast incremental calls thus would keep piling them up.  Therefore
+// after 'opts.popcollect' popped contexts we collect garbage and compact
+// at the start of the next 'solve' call.
+
+int Internal::new_activation_variable () {
+  if (i2e.empty ()) i2e.push_back (0);
+  assert (i2e.size () == (size_t) max_var + 1);
+  const int idx = max_var + 1;
+  init (idx);
+  i2e.push_back (0);
+  mark_active (idx);
+  freeze (idx);
+  assert (internal_only (idx));
+  return idx;
+}
+
+bool Internal::internal_only (Clause * c) const {
+  for (const auto & lit : *c)
+    if (internal_only (lit))
+      return true;
+  return false;
+}
+
+void External::push () {
+  reset_extended ();
+  const int act = internal->new_activation_variable ();
+  contexts.push_back (act);
+  pushed.push_back (original.size ());
+  internal->stats.pushed++;
+  LOG ("pushed context %zd with internal activation literal %d",
+    contexts.size (), act);
+}
+
+// The saved original clauses of the context are dropped too, since they
+// do not have to be satisfied anymore.
+
+void External::pop () {
+  assert (!contexts.empty ());
+  reset_extended ();
+  const int act = contexts.back ();
+  LOG ("popping context %zd with internal activation literal %d",
+    contexts.size (), act);
+  contexts.pop_back ();
+  original.resize (pushed.back ());
+  pushed.pop_back ();
+  internal->add_original_lit (-act);
+  internal->add_original_lit (0);
+  internal->melt (act);
+  internal->stats.popped++;
+}
+
+void External::assume_contexts () {
+  for (const auto & act : contexts) {
+    LOG ("assuming internal activation literal %d", act);
+    internal->assume (act);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+// Called at the root level in 'solve' after propagating all units.
+
+void Internal::collect_contexts () {
+  if (!opts.popcollect) return;
+  if (stats.popped - last.collect.popped < opts.popcollect) return;
+  last.collect.popped = stats.popped;
+  assert (!level);
+  assert (propagated == trail.size ());
+  if (opts.compact && active () < max_var) compact ();
+  else garbage_collection ();
+}
+
+}
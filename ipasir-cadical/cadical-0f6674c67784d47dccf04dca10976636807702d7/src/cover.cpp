@@ -100,6 +100,17 @@ Internal::cover_propagate_asymmetric (int lit,
   assert (val (lit) < 0);
   bool subsumed = false;
   LOG ("asymmetric literal propagation of %d", lit);
+  for (const auto & w : binaries (lit)) {
+    if (w.clause == ignore) continue;
+    const int b = val (w.blit);
+    if (b > 0) continue;
+    if (w.clause->garbage) continue;
+    if (b < 0) {
+      LOG (w.clause, "found subsuming");
+      subsumed = true;
+      break;
+    } else asymmetric_literal_addition (-w.blit, coveror);
+  }
   Watches & ws = watches (lit);
   const const_watch_iterator eow = ws.end ();
   watch_iterator j = ws.begin ();
@@ -110,12 +121,7 @@ Internal::cover_propagate_asymmetric (int lit,
     const int b = val (w.blit);
     if (b > 0) continue;
     if (w.clause->garbage) j--;
-    else if (w.binary ()) {
-      if (b < 0) {
-        LOG (w.clause, "found subsuming");
-        subsumed = true;
-      } else asymmetric_literal_addition (-w.blit, coveror);
-    } else {
+    else {
       literal_iterator lits = w.clause->begin ();
       const int other = lits[0]^lits[1]^lit;
       lits[0] = other, lits[1] = lit;
@@ -283,6 +289,11 @@ bool Internal::cover_clause (Clause * c, Coveror & coveror) {
     return false;
   }
 
+  if (internal_only (c)) {
+    LOG (c, "can not eliminate context clause");
+    return false;
+  }
+
   assert (coveror.added.empty ());
   assert (coveror.extend.empty ());
   assert (coveror.clause.empty ());
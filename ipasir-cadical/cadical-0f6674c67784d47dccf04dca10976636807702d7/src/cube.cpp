@@ -0,0 +1,125 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Cube generation for cube-and-conquer ('opts.cube').  The formula under
+// the current assumptions is split into cubes, i.e., conjunctions of at
+// most 'opts.cubedepth' decisions, which are then solved in parallel by
+// copies of the solver in 'Solver::conquer'.  Similar to failed literal
+// probing both phases of the first 'opts.cubecands' unassigned variables
+// on the decision queue are propagated, and we split on the variable which
+// maximizes the product of the number of implied literals of both phases.
+// Branches in which propagation fails are not turned into cubes, since the
+// search of the solver refutes them immediately anyhow.
+
+/*------------------------------------------------------------------------*/
+
+// Propagate 'lit' on a new decision level and return the number of implied
+// literals including 'lit' itself or '-1' if propagation fails.
+
+int Internal::lookahead_probe (int lit) {
+  assert (!val (lit));
+  assert (propagated == trail.size ());
+  const size_t before = trail.size ();
+  search_assume_decision (lit);
+  int res = propagate () ? (int) (trail.size () - before) : -1;
+  backtrack (level - 1);
+  conflict = 0;
+  LOG ("lookahead on %d implies %d literals", lit, res);
+  return res;
+}
+
+// Return the best variable to split on or zero if all are assigned.  A
+// failed literal is split on immediately, since one branch is pruned.
+
+int Internal::lookahead_variable () {
+  int res = 0, candidates = 0;
+  int64_t best = -1;
+  for (int idx = queue.last;
+       idx && candidates < opts.cubecands;
+       idx = link (idx).prev) {
+    if (val (idx)) continue;
+    if (!active (idx)) continue;
+    candidates++;
+    const int pos = lookahead_probe (idx);
+    const int neg = lookahead_probe (-idx);
+    if (pos < 0 || neg < 0) return idx;
+    const int64_t score = (pos + (int64_t) 1) * (neg + (int64_t) 1);
+    if (score <= best) continue;
+    best = score;
+    res = idx;
+  }
+  LOG ("lookahead variable %d with score %" PRId64 "", res, best);
+  return res;
+}
+
+void Internal::split_cube (int depth,
+                           vector<int> & cube, vector<vector<int>> & cubes)
+{
+  const int idx = depth ? lookahead_variable () : 0;
+  if (!idx) {
+    cubes.push_back (cube);
+    return;
+  }
+  const int before = level;
+  const int phase = decide_phase (idx, false) < 0 ? -1 : 1;
+  for (int lit = phase * idx; ; lit = -lit) {
+    search_assume_decision (lit);
+    if (propagate ()) {
+      cube.push_back (externalize (lit));
+      split_cube (depth - 1, cube, cubes);
+      cube.pop_back ();
+    } else conflict = 0;
+    backtrack (before);
+    if (lit != phase * idx) break;
+  }
+}
+
+// Cubes are returned as external literals and do not contain the
+// assumptions.  If propagating the assumptions fails no cube is generated
+// and the standard search has to determine the failed assumptions.  As in
+// 'propagate_assumptions' clauses with tainted witnesses are restored
+// first, since otherwise the copies in 'conquer' would get an extension
+// stack which does not fit their clauses.
+
+void Internal::generate_cubes (int depth, vector<vector<int>> & cubes) {
+  assert (cubes.empty ());
+  if (unsat) return;
+  if (level) backtrack ();
+  if (!propagate ()) {
+    LOG ("root level propagation produces conflict");
+    learn_empty_clause ();
+    return;
+  }
+  if (opts.restoreall > 1 || !external->tainted.empty ()) {
+    external->restore_clauses ();
+    if (!unsat && !propagate ()) {
+      LOG ("root level propagation after restore produces conflict");
+      learn_empty_clause ();
+    }
+    if (unsat) return;
+  }
+  const vector<Phase> saved = phases.saved;
+  bool failed = false;
+  for (const auto & lit : assumptions) {
+    const int tmp = val (lit);
+    if (tmp > 0) continue;
+    if (tmp < 0) { failed = true; break; }
+    search_assume_decision (lit);
+    if (propagate ()) continue;
+    conflict = 0;
+    failed = true;
+    break;
+  }
+  if (!failed) {
+    vector<int> cube;
+    split_cube (depth, cube, cubes);
+  }
+  backtrack ();
+  phases.saved = saved;
+  VERBOSE (2, "generated %zd cubes of depth %d", cubes.size (), depth);
+}
+
+}
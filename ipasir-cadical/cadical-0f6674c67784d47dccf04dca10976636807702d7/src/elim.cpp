@@ -542,6 +542,16 @@ Internal::try_to_eliminate_variable (Eliminator & eliminator, int pivot) {
     return;
   }
 
+  // Clauses with internal only activation literals of contexts can not be
+  // pushed on the extension stack (see 'context.cpp').
+  //
+  for (int sign = -1; sign <= 1; sign += 2)
+    for (const auto & c : occs (sign * pivot))
+      if (internal_only (c)) {
+        LOG (c, "context clause thus not eliminated %d", pivot);
+        return;
+      }
+
   LOG ("trying to eliminate %d", pivot);
   assert (!flags (pivot).eliminated ());
 
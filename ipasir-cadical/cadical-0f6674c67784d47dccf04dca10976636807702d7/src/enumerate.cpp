@@ -0,0 +1,108 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Projected model enumeration on top of incremental solving.  After each
+// model the projected model is blocked by adding a clause.  Instead of the
+// negation of the whole projected model, which makes blocking clauses as
+// long as the projection, only its 'decisions' are negated.  These are the
+// projected literals not implied by propagating the previous ones in the
+// order of the projection.  Since the model satisfies all clauses, every
+// model agreeing with the decisions agrees with all implied literals too,
+// so exactly one projected model is blocked by the shorter clause.
+//
+// The blocking clauses are added to a new context (see 'context.cpp'),
+// which is popped at the end.  Thus they are guarded by an internal only
+// activation literal, which neither takes a variable of the application
+// nor grows 'e2i', and popping the context lets garbage collection remove
+// them.  The projected variables are frozen during enumeration to keep
+// them from being eliminated.
+
+// Reduces the internal literals in 'lits', which have to be satisfiable,
+// to those which are not implied by the previous ones.
+
+void Internal::enumerate_decisions (vector<int> & lits) {
+  if (level) backtrack ();
+  if (!propagate ()) {
+    LOG ("root level propagation produces conflict");
+    learn_empty_clause ();
+    return;
+  }
+  const auto end = lits.end ();
+  auto j = lits.begin ();
+  bool failed = false;
+  for (auto i = j; i != end; i++) {
+    const int lit = *i;
+    if (!failed) {
+      const int tmp = val (lit);
+      if (tmp > 0) continue;
+      if (tmp < 0) failed = true;
+      else {
+        search_assume_decision (lit);
+        if (!propagate ()) { conflict = 0; failed = true; }
+      }
+    }
+    *j++ = lit;
+  }
+  lits.resize (j - lits.begin ());
+  backtrack ();
+  LOG ("reduced blocking clause to %zd decisions", lits.size ());
+}
+
+int External::enumerate (Enumerator & enumerator,
+                         const vector<int> & projection, int64_t limit) {
+
+  const vector<int> assumed = assumptions;
+
+  vector<int> vars;
+  if (projection.empty ()) variables (vars);
+  else
+    for (const auto & elit : projection) vars.push_back (abs (elit));
+  for (const auto & idx : vars) freeze (idx);
+
+  push ();
+
+  vector<int> model, lits;
+  int64_t models = 0;
+  int res;
+
+  for (;;) {
+
+    reset_assumptions ();
+    for (const auto & elit : assumed)
+      assume (elit);
+
+    res = solve ();
+    if (res != 10) break;
+
+    model.clear ();
+    for (const auto & idx : vars)
+      model.push_back (val (idx));
+    models++;
+    if (!enumerator.model (model)) break;
+    if (limit > 0 && models >= limit) break;
+
+    const int act = contexts.back ();     // Changed by 'compact'.
+    lits.clear ();
+    lits.push_back (act);                 // Previous blocking clauses.
+    for (const auto & elit : model)
+      lits.push_back (internalize (elit));
+    internal->enumerate_decisions (lits);
+
+    for (const auto & ilit : lits)
+      if (ilit != act) add (-internal->externalize (ilit));
+    add (0);
+  }
+
+  reset_assumptions ();
+  pop ();
+  for (const auto & idx : vars) melt (idx);
+
+  VERBOSE (2, "enumerated %" PRId64 " models", models);
+
+  return res;
+}
+
+}
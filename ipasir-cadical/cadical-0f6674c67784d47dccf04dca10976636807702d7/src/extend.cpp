@@ -98,12 +98,10 @@ void External::extend () {
     internal->max_var, max_var);
 
   int64_t updated = 0;
-  for (unsigned i = 1; i <= (unsigned) max_var; i++) {
+  for (int i = 1; i <= max_var; i = e2i.next (i)) {
     const int ilit = e2i[i];
     if (!ilit) continue;
-    while (i >= vals.size ())
-      vals.push_back (false);
-    vals[i] = (internal->val (ilit) > 0);
+    vals.ref (i) = (internal->val (ilit) > 0);
     updated++;
   }
   PHASE ("extend", internal->stats.extensions,
@@ -135,9 +133,7 @@ void External::extend () {
           assert (lit);
           assert (lit != INT_MIN);
           int idx = abs (lit);
-          while ((size_t) idx >= vals.size ())
-            vals.push_back (false);
-          vals[idx] = !vals[idx];
+          vals.ref (idx) = !vals[idx];
           internal->stats.extended++;
           flipped++;
         }
@@ -9,6 +9,8 @@ External::External (Internal * i)
   vsize (0),
   extended (false),
   terminator (0),
+  learner (0),
+  importer (0),
   solution (0)
 {
   assert (internal);
@@ -30,41 +32,48 @@ void External::enlarge (int new_max_var) {
   vsize = new_vsize;
 }
 
+// In 'sparse' mode external variables are only mapped to internal
+// variables when they are used in 'internalize', while otherwise all
+// variables up to 'new_max_var' get a new internal variable.
+
 void External::init (int new_max_var) {
   assert (!extended);
   if (new_max_var <= max_var) return;
+  if (internal->i2e.empty ()) internal->i2e.push_back (0);
+  if (internal->opts.sparse) {
+    LOG ("sparse external variables up to %d", new_max_var);
+    max_var = new_max_var;
+    return;
+  }
   int new_vars = new_max_var - max_var;
   int old_internal_max_var = internal->max_var;
   int new_internal_max_var = old_internal_max_var + new_vars;
   internal->init (new_internal_max_var);
   if ((size_t) new_max_var >= vsize) enlarge (new_max_var);
   LOG ("initialized %d external variables", new_vars);
-  if (!max_var) {
-    assert (e2i.empty ());
-    e2i.push_back (0);
-    assert (internal->i2e.empty ());
-    internal->i2e.push_back (0);
-  } else {
-    assert (e2i.size () == (size_t) max_var + 1);
-    assert (internal->i2e.size () == (size_t) old_internal_max_var + 1);
-  }
+  assert (internal->i2e.size () == (size_t) old_internal_max_var + 1);
   int iidx = old_internal_max_var + 1, eidx;
   for (eidx = max_var + 1; eidx <= new_max_var; eidx++, iidx++) {
     LOG ("mapping external %d to internal %d", eidx, iidx);
-    assert (e2i.size () == (size_t) eidx);
-    e2i.push_back (iidx);
+    assert (!e2i[eidx]);
+    e2i.ref (eidx) = iidx;
     internal->i2e.push_back (eidx);
     assert (internal->i2e[iidx] == eidx);
     assert (e2i[eidx] == iidx);
   }
-  if (internal->opts.checkfrozen)
-    while (new_max_var >= (int64_t) moltentab.size ())
-      moltentab.push_back (false);
   assert (iidx == new_internal_max_var + 1);
   assert (eidx == new_max_var + 1);
   max_var = new_max_var;
 }
 
+void External::variables (vector<int> & vars) const {
+  const bool sparse = internal->opts.sparse;
+  for (int idx = 1; idx <= max_var; idx = e2i.next (idx))
+    if (!sparse || e2i[idx] ||
+        marked (witness, idx) || marked (witness, -idx))
+      vars.push_back (idx);
+}
+
 /*------------------------------------------------------------------------*/
 
 void External::reset_assumptions () {
@@ -95,16 +104,14 @@ int External::internalize (int elit) {
     if (!ilit) {
       ilit = internal->max_var + 1;
       internal->init (ilit);
-      e2i[eidx] = ilit;
       LOG ("mapping external %d to internal %d", eidx, ilit);
-      e2i[eidx] = ilit;
+      e2i.ref (eidx) = ilit;
       internal->i2e.push_back (eidx);
       assert (internal->i2e[ilit] == eidx);
       assert (e2i[eidx] == ilit);
       if (elit < 0) ilit = -ilit;
     }
     if (internal->opts.checkfrozen) {
-      assert (eidx < (int64_t) moltentab.size ());
       if (moltentab[eidx])
         FATAL ("can not reuse molten literal %d", eidx);
     }
@@ -121,6 +128,9 @@ int External::internalize (int elit) {
   return ilit;
 }
 
+// Clauses added while contexts are open get the negated (internal only)
+// activation literal of the innermost context (see 'context.cpp').
+
 void External::add (int elit) {
   assert (elit != INT_MIN);
   reset_extended ();
@@ -130,6 +140,8 @@ void External::add (int elit) {
   const int ilit = internalize (elit);
   assert (!elit == !ilit);
   if (elit) LOG ("adding external %d as internal %d", elit, ilit);
+  else if (!contexts.empty ())
+    internal->add_original_lit (-contexts.back ());
   internal->add_original_lit (ilit);
 }
 
@@ -143,6 +155,24 @@ void External::assume (int elit) {
   internal->assume (ilit);
 }
 
+// As in 'val' variables beyond 'max_var' are false.
+
+void External::val_range (int first, int last, int * res) const {
+  assert (0 < first);
+  const int assigned = min (last, max_var);
+  int idx = first;
+  while (idx <= assigned) *res++ = vals[idx] ? idx : -idx, idx++;
+  while (idx <= last) *res++ = -idx, idx++;
+}
+
+void External::val_range (int first, int last, signed char * res) const {
+  assert (0 < first);
+  const int assigned = min (last, max_var);
+  int idx = first;
+  while (idx <= assigned) *res++ = vals[idx] ? 1 : -1, idx++;
+  while (idx <= last) *res++ = -1, idx++;
+}
+
 bool External::failed (int elit) {
   assert (elit);
   assert (elit != INT_MIN);
@@ -154,6 +184,68 @@ bool External::failed (int elit) {
   return internal->failed (ilit);
 }
 
+// Collects failed assumptions in the order of 'assumptions'.
+
+// Literals assumed several times are only reported once.
+
+int External::failed_core (int * core, int size) {
+  vector<bool> reported;
+  int res = 0;
+  for (const auto & elit : assumptions) {
+    if (marked (reported, elit)) continue;
+    if (!failed (elit)) continue;
+    mark (reported, elit);
+    if (res < size) core[res] = elit;
+    res++;
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Pass learned clauses in terms of external literals to the learner.
+
+void External::export_learned_empty_clause () {
+  assert (learner);
+  if (learner->learning (0, 0)) {
+    LOG ("exporting learned empty clause");
+    learner->learn (0);
+  } else LOG ("not exporting learned empty clause");
+}
+
+// Learned clauses with activation literals depend on the clauses of open
+// contexts and are not exported.
+
+void External::export_learned_unit_clause (int ilit) {
+  assert (learner);
+  if (internal->internal_only (ilit))
+    LOG ("not exporting learned unit clause %d of context", ilit);
+  else if (learner->learning (1, 1)) {
+    LOG ("exporting learned unit clause");
+    learner->learn (internal->externalize (ilit));
+    learner->learn (0);
+  } else LOG ("not exporting learned unit clause");
+}
+
+void External::export_learned_large_clause (const vector<int> & clause,
+                                            int glue) {
+  assert (learner);
+  for (const auto & ilit : clause)
+    if (internal->internal_only (ilit)) {
+      LOG ("not exporting learned clause of size %zd of context",
+        clause.size ());
+      return;
+    }
+  if (learner->learning ((int) clause.size (), glue)) {
+    LOG ("exporting learned clause of size %zd and glue %d",
+      clause.size (), glue);
+    for (const auto & ilit : clause)
+      learner->learn (internal->externalize (ilit));
+    learner->learn (0);
+  } else LOG ("not exporting learned clause of size %zd and glue %d",
+    clause.size (), glue);
+}
+
 /*------------------------------------------------------------------------*/
 
 // Internal checker if 'solve' claims the formula to be satisfiable.
@@ -189,9 +281,10 @@ void External::check_solve_result (int res) {
 
 void External::update_molten_literals () {
   if (!internal->opts.checkfrozen) return;
-  assert (max_var + 1 == (int64_t) moltentab.size ());
   int registered = 0, molten = 0;
-  for (int lit = 1; lit <= max_var; lit++) {
+  vector<int> vars;
+  variables (vars);
+  for (const auto & lit : vars) {
     if (moltentab[lit]) {
       LOG ("skipping already molten literal %d", lit);
       molten++;
@@ -199,7 +292,7 @@ void External::update_molten_literals () {
       LOG ("skipping currently frozen literal %d", lit);
     else {
       LOG ("new molten literal %d", lit);
-      moltentab[lit] = true;
+      moltentab.ref (lit) = true;
       registered++;
       molten++;
     }
@@ -211,13 +304,41 @@ void External::update_molten_literals () {
 int External::solve () {
   reset_extended ();
   update_molten_literals ();
+  assume_contexts ();
   int res = internal->solve ();
   if (res == 10) extend ();
   check_solve_result (res);
+  if (res == 20 && internal->opts.shrinkcore) shrink_core ();
   reset_limits ();
   return res;
 }
 
+// Writes at most 'size' of the literals implied by the assumptions to
+// 'implied' in trail order and returns the number of all of them or '-1'
+// if propagation runs into a conflict.  Literals fixed at the root level
+// are not considered to be implied.
+
+int External::propagate (int * implied, int size) {
+  reset_extended ();
+  update_molten_literals ();
+  assume_contexts ();
+  int res = -1;
+  if (!internal->propagate_assumptions ()) {
+    res = 0;
+    if (internal->level) {
+      const auto & trail = internal->trail;
+      for (size_t i = internal->control[1].trail; i < trail.size (); i++) {
+        const int elit = internal->externalize (trail[i]);
+        if (!elit) continue;            // Activation literal.
+        if (res < size) implied[res] = elit;
+        res++;
+      }
+    }
+  }
+  if (internal->level) internal->backtrack ();
+  return res;
+}
+
 void External::terminate () { internal->terminate (); }
 
 /*------------------------------------------------------------------------*/
@@ -226,9 +347,7 @@ void External::freeze (int elit) {
   reset_extended ();
   int ilit = internalize (elit);
   unsigned eidx = vidx (elit);
-  while (eidx >= frozentab.size ())
-    frozentab.push_back (0);
-  unsigned & ref = frozentab[eidx];
+  unsigned & ref = frozentab.ref (eidx);
   if (ref < UINT_MAX) {
     ref++;
     LOG ("external variable %d frozen once and now frozen %u times",
@@ -242,8 +361,7 @@ void External::melt (int elit) {
   reset_extended ();
   int ilit = internalize (elit);
   unsigned eidx = vidx (elit);
-  assert (eidx < frozentab.size ());
-  unsigned & ref = frozentab[eidx];
+  unsigned & ref = frozentab.ref (eidx);
   assert (ref > 0);
   if (ref < UINT_MAX) {
     if (!--ref)
@@ -263,7 +381,7 @@ void External::check_assignment (int (External::*a)(int) const) {
 
   // First check all assigned and consistent.
   //
-  for (int idx = 1; idx <= max_var; idx++) {
+  for (int idx = 1; idx <= max_var; idx = e2i.next (idx)) {
     if (!(this->*a) (idx)) FATAL ("unassigned variable: %d", idx);
     if ((this->*a) (idx) != -(this->*a)(-idx))
       FATAL ("inconsistently assigned literals %d and %d", idx, -idx);
@@ -339,7 +457,7 @@ bool External::traverse_all_frozen_units_as_clauses (ClauseIterator & it) {
 
   vector<int> clause;
 
-  for (int idx = 1; idx <= max_var; idx++) {
+  for (int idx = 1; idx <= max_var; idx = e2i.next (idx)) {
     const int tmp = fixed (idx);
     if (!tmp) continue;
     if (!frozen (idx)) continue;
@@ -362,7 +480,7 @@ External::traverse_all_non_frozen_units_as_witnesses (WitnessIterator & it)
 
   vector<int> clause_and_witness;
 
-  for (int idx = 1; idx <= max_var; idx++) {
+  for (int idx = 1; idx <= max_var; idx = e2i.next (idx)) {
     if (frozen (idx)) continue;
     const int tmp = fixed (idx);
     if (!tmp) continue;
@@ -1,6 +1,8 @@
 #ifndef _external_hpp_INCLUDED
 #define _external_hpp_INCLUDED
 
+#include "paged.hpp"    // Alphabetically after 'external.hpp'.
+
 /*------------------------------------------------------------------------*/
 
 namespace CaDiCaL {
@@ -50,10 +52,12 @@ struct External {
   Internal * internal;    // The actual internal solver.
   int max_var;            // External maximum variable index.
   size_t vsize;
-  vector<bool> vals;      // Current external (extended) assignment.
-  vector<int> e2i;        // External 'idx' to internal 'lit' [1,max_var].
+  Paged<bool> vals;       // Current external (extended) assignment.
+  Paged<int> e2i;         // External 'idx' to internal 'lit' [1,max_var].
 
   vector<int> assumptions;      // External assumptions.
+  vector<int> contexts;         // Internal activation literals of contexts.
+  vector<size_t> pushed;        // Size of 'original' when pushing them.
 
   /*----------------------------------------------------------------------*/
 
@@ -158,7 +162,7 @@ struct External {
   // internally and implicitly assumed literals).  Passes on freezing and
   // melting to the internal solver, which has separate frozen counters.
 
-  vector<unsigned> frozentab;
+  Paged<unsigned> frozentab;
 
   void freeze (int elit);
   void melt (int elit);
@@ -168,7 +172,6 @@ struct External {
     assert (elit != INT_MIN);
     int eidx = abs (elit);
     if (eidx > max_var) return false;
-    if (eidx >= (int) frozentab.size ()) return false;
     return frozentab[eidx] > 0;
   }
 
@@ -177,7 +180,7 @@ struct External {
   // marked at the beginning of the 'solve' call.  Note that variables
   // larger than 'max_var' are not molten and can be used in the future.
   //
-  vector<bool> moltentab;
+  Paged<bool> moltentab;
 
   /*----------------------------------------------------------------------*/
 
@@ -189,6 +192,12 @@ struct External {
 
   int internalize (int);        // Translate external to internal literal.
 
+  // Collects all external variables in '[1,max_var]' except that in
+  // 'sparse' mode only variables which are mapped to internal variables or
+  // occur as witness on the extension stack are considered.
+  //
+  void variables (vector<int> &) const;
+
   /*----------------------------------------------------------------------*/
 
   // According to the CaDiCaL API contract (as well as IPASIR) we have to
@@ -221,22 +230,36 @@ struct External {
 
   void add (int elit);
   void assume (int elit);
+  void push ();
+  void pop ();
+  void assume_contexts ();
   int solve ();
+  int propagate (int * implied, int size);
+  void backbone_phases (const vector<int> & candidates);
+  int backbone (vector<int> & backbone);
+  int enumerate (Enumerator &, const vector<int> & projection, int64_t limit);
+  void shrink_core ();
   void terminate ();
 
   inline int val (int elit) const {
     assert (elit != INT_MIN);
     int eidx = abs (elit), res;
-    if (eidx > max_var) res = -1;
-    else if ((size_t) eidx >= vals.size ()) res = -1;
+    if (eidx > max_var) res = -eidx;
     else res = vals[eidx] ? eidx : -eidx;
     if (elit < 0) res = -res;
     return res;
   }
 
+  // Bulk versions of 'val' for the variables in '[first,last]' writing
+  // the values respectively their signs to consecutive positions.
+  //
+  void val_range (int first, int last, int * res) const;
+  void val_range (int first, int last, signed char * res) const;
+
   int fixed (int elit) const;   // Implemented in 'internal.hpp'.
 
   bool failed (int elit);
+  int failed_core (int * core, int size);
 
   /*----------------------------------------------------------------------*/
 
@@ -245,6 +268,21 @@ struct External {
 
   Terminator * terminator;
 
+  // Optional learner to export learned clauses.  The learner is set from
+  // 'Solver::connect_learner' and called from 'learn_empty_clause',
+  // 'learn_unit_clause' and 'new_learned_redundant_clause' in 'Internal'.
+
+  Learner * learner;
+
+  void export_learned_empty_clause ();
+  void export_learned_unit_clause (int ilit);
+  void export_learned_large_clause (const vector<int> &, int glue);
+
+  // Optional importer polled in 'Internal::restart' for clauses to add.
+  // It is set from 'Solver::connect_importer'.
+
+  Importer * importer;
+
   /*----------------------------------------------------------------------*/
 
   signed char * solution; // For checking & debugging [1,max_var]
@@ -7,6 +7,7 @@
 extern "C" {
 #include <string.h>
 #include <errno.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -30,6 +31,7 @@ File::File (Internal *i, bool w, int c, FILE * f, const char * n)
   writing (w),
 #endif
   close_file (c), file (f),
+  map (0), map_pos (0), map_end (0),
   _name (n), _lineno (1), _bytes (0)
 {
   (void) i, (void) w;
@@ -38,6 +40,32 @@ File::File (Internal *i, bool w, int c, FILE * f, const char * n)
 
 /*------------------------------------------------------------------------*/
 
+// Mapping avoids copying through the 'FILE' buffer and allows the parser to
+// split the file into chunks.  It is only tried for non-empty regular files
+// and if it fails we silently keep reading through 'file'.
+
+void File::map_file () {
+  assert (!writing), assert (!map);
+  struct stat buf;
+  const int fd = fileno (file);
+  if (fd < 0 || fstat (fd, &buf) || !S_ISREG (buf.st_mode)) return;
+  const size_t bytes = buf.st_size;
+  if (!bytes || (off_t) bytes != buf.st_size) return;
+  void * res = mmap (0, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (res == MAP_FAILED) return;
+  (void) madvise (res, bytes, MADV_SEQUENTIAL);
+  map = map_pos = (const char *) res;
+  map_end = map + bytes;
+}
+
+void File::unmap_file () {
+  if (!map) return;
+  munmap ((void *) map, map_end - map);
+  map = map_pos = map_end = 0;
+}
+
+/*------------------------------------------------------------------------*/
+
 bool File::exists (const char * path) {
   struct stat buf;
   if (stat (path, &buf)) return false;
@@ -237,7 +265,10 @@ READ_FILE:
     close_input = 1;
   }
 
-  return file ? new File (internal, false, close_input, file, path) : 0;
+  if (!file) return 0;
+  File * res = new File (internal, false, close_input, file, path);
+  if (close_input == 1) res->map_file ();
+  return res;
 }
 
 File * File::write (Internal * internal, const char * path) {
@@ -260,6 +291,7 @@ File * File::write (Internal * internal, const char * path) {
 
 void File::close () {
   assert (file);
+  unmap_file ();
   if (close_file == 0) {
     VERBOSE (1, "disconnecting from '%s'", name ());
   }
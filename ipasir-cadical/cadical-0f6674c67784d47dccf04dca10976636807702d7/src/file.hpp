@@ -39,6 +39,14 @@ class File {
 
   int close_file;       // need to close file (1=fclose, 2=pclose)
   FILE * file;
+
+  // Plain files opened for reading are mapped into memory if possible.
+  // Then 'get' reads from 'map_pos' instead of going through 'file'.
+  //
+  const char * map;
+  const char * map_pos;
+  const char * map_end;
+
   const char * _name;
   int64_t _lineno;
   int64_t _bytes;
@@ -60,6 +68,10 @@ class File {
                            const char * path);
   static FILE * write_pipe (Internal *,
                             const char * fmt, const char * path);
+
+  void map_file ();
+  void unmap_file ();
+
 public:
 
   static char* find (const char * prg);    // search in 'PATH'
@@ -93,7 +105,9 @@ public:
 
   int get () {
     assert (!writing);
-    int res = cadical_getc_unlocked (file);
+    int res;
+    if (map) res = (map_pos < map_end) ? (unsigned char) *map_pos++ : EOF;
+    else res = cadical_getc_unlocked (file);
     if (res == '\n') _lineno++;
     if (res != EOF) _bytes++;
     return res;
@@ -163,6 +177,23 @@ public:
     }
   }
 
+  // The not yet read part of a mapped file, which allows to tokenize it
+  // without 'get' (and in parallel).  Then 'skip' moves forward over the
+  // given number of bytes containing the given number of new-lines.
+  //
+  bool mapped () const { return map; }
+  const char * remaining (size_t & bytes) const {
+    assert (map);
+    bytes = map_end - map_pos;
+    return map_pos;
+  }
+  void skip (size_t bytes, int64_t lines) {
+    assert (map), assert (bytes <= (size_t) (map_end - map_pos));
+    map_pos += bytes;
+    _bytes += bytes;
+    _lineno += lines;
+  }
+
   const char * name () const { return _name; }
   int64_t lineno () const { return _lineno; }
   int64_t bytes () const { return _bytes; }
@@ -0,0 +1,99 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Clauses from a connected 'Importer', e.g., clauses learned by other
+// solvers working on the same formula, are added as redundant clauses on
+// the root level.  The importer is polled before the search starts and on
+// every restart.  Since the clauses are not derived by this solver they are
+// trusted to be implied by the formula and can not be checked by 'proof'.
+// Thus nothing is imported while a proof is traced or checked.
+
+void Internal::import_clauses () {
+  assert (external->importer);
+  if (proof) { LOG ("not importing clauses while tracing proof"); return; }
+  size_t size = 0;
+  const int * lits = external->importer->import (size);
+  import_clauses (lits, size);
+}
+
+// Add the zero terminated external clauses in 'lits' as redundant clauses.
+// Also used for the clauses derived from refuted cubes in 'conquer'.  While
+// contexts are open imported clauses might depend on their clauses and
+// thus belong to the innermost context, i.e., get its negated activation
+// literal added (see 'context.cpp').
+
+void Internal::import_clauses (const int * lits, size_t size) {
+
+  assert (!unsat);
+  assert (!proof);
+
+  if (!size) return;
+
+  if (level) backtrack ();
+
+  const int * end = lits + size;
+  const int * p = lits;
+
+  while (!unsat && p != end) {
+
+    assert (clause.empty ());
+    bool skip = false;
+
+    // Map the clause to internal literals and simplify it on-the-fly by
+    // removing duplicated and falsified literals.  Clauses over inactive
+    // (unused, eliminated or substituted) variables are skipped.
+    //
+    while (p != end && *p) {
+      const int elit = *p++;
+      if (skip) continue;
+      const int eidx = abs (elit);
+      int ilit = eidx <= external->max_var ? external->e2i[eidx] : 0;
+      if (!ilit) { skip = true; continue; }
+      if (elit < 0) ilit = -ilit;
+      int tmp = val (ilit);
+      if (tmp > 0) { skip = true; continue; }
+      if (tmp < 0) continue;
+      if (!active (ilit)) { skip = true; continue; }
+      tmp = marked (ilit);
+      if (tmp < 0) skip = true;
+      else if (!tmp) mark (ilit), clause.push_back (ilit);
+    }
+
+    for (const auto & lit : clause)
+      unmark (lit);
+
+    if (p == end) skip = true;  // Ignore unterminated clause.
+    else p++;
+
+    if (!skip && !external->contexts.empty ()) {
+      const int lit = -external->contexts.back ();
+      const int tmp = val (lit);
+      if (tmp > 0) skip = true;
+      else if (!tmp) clause.push_back (lit);
+    }
+
+    if (skip) {
+      LOG (clause, "skipping imported");
+    } else {
+      stats.imported++;
+      const size_t new_size = clause.size ();
+      if (!new_size) {
+        LOG ("imported empty clause");
+        learn_empty_clause ();
+      } else if (new_size == 1) {
+        LOG ("imported unit clause %d", clause[0]);
+        assign_unit (clause[0]);
+      } else {
+        Clause * c = new_clause (true, (int) new_size);
+        LOG (c, "imported");
+        watch_clause (c);
+      }
+    }
+    clause.clear ();
+  }
+}
+
+}
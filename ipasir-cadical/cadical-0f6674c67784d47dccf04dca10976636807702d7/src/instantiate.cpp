@@ -64,6 +64,13 @@ bool Internal::inst_propagate () {      // Adapted from 'propagate'.
   while (ok && propagated != trail.size ()) {
     const int lit = -trail[propagated++];
     LOG ("instantiate propagating %d", -lit);
+    for (const auto & w : binaries (lit)) {
+      const int b = val (w.blit);
+      if (b > 0) continue;
+      if (b < 0) { ok = false; LOG (w.clause, "conflict"); break; }
+      else inst_assign (w.blit);
+    }
+    if (!ok) break;
     Watches & ws = watches (lit);
     const const_watch_iterator eow = ws.end ();
     const_watch_iterator i = ws.begin ();
@@ -72,49 +79,44 @@ bool Internal::inst_propagate () {      // Adapted from 'propagate'.
       const Watch w = *j++ = *i++;
       const int b = val (w.blit);
       if (b > 0) continue;
-      if (w.binary ()) {
-        if (b < 0) { ok = false; LOG (w.clause, "conflict"); break; }
-        else inst_assign (w.blit);
-      } else {
-        literal_iterator lits = w.clause->begin ();
-        const int other = lits[0]^lits[1]^lit;
-        lits[0] = other, lits[1] = lit;
-        const int u = val (other);
-        if (u > 0) j[-1].blit = other;
-        else {
-          const int size = w.clause->size;
-          const const_literal_iterator end = lits + size;
-          const literal_iterator middle = lits + w.clause->pos;
-          literal_iterator k = middle;
-          int v = -1, r = 0;
-          while (k != end && (v = val (r = *k)) < 0)
+      literal_iterator lits = w.clause->begin ();
+      const int other = lits[0]^lits[1]^lit;
+      lits[0] = other, lits[1] = lit;
+      const int u = val (other);
+      if (u > 0) j[-1].blit = other;
+      else {
+        const int size = w.clause->size;
+        const const_literal_iterator end = lits + size;
+        const literal_iterator middle = lits + w.clause->pos;
+        literal_iterator k = middle;
+        int v = -1, r = 0;
+        while (k != end && (v = val (r = *k)) < 0)
+          k++;
+        if (v < 0) {
+          k = lits + 2;
+          assert (w.clause->pos <= size);
+          while (k != middle && (v = val (r = *k)) < 0)
             k++;
-          if (v < 0) {
-            k = lits + 2;
-            assert (w.clause->pos <= size);
-            while (k != middle && (v = val (r = *k)) < 0)
-              k++;
-          }
-          w.clause->pos = k - lits;
-          assert (lits + 2 <= k), assert (k <= w.clause->end ());
-          if (v > 0) {
-            j[-1].blit = r;
-          } else if (!v) {
-            LOG (w.clause, "unwatch %d in", r);
-            lits[1] = r;
-            *k = lit;
-            watch_literal (r, lit, w.clause);
-            j--;
-          } else if (!u) {
-            assert (v < 0);
-            inst_assign (other);
-          } else {
-            assert (u < 0);
-            assert (v < 0);
-            LOG (w.clause, "conflict");
-            ok = false;
-            break;
-          }
+        }
+        w.clause->pos = k - lits;
+        assert (lits + 2 <= k), assert (k <= w.clause->end ());
+        if (v > 0) {
+          j[-1].blit = r;
+        } else if (!v) {
+          LOG (w.clause, "unwatch %d in", r);
+          lits[1] = r;
+          *k = lit;
+          watch_literal (r, lit, w.clause);
+          j--;
+        } else if (!u) {
+          assert (v < 0);
+          inst_assign (other);
+        } else {
+          assert (u < 0);
+          assert (v < 0);
+          LOG (w.clause, "conflict");
+          ok = false;
+          break;
         }
       }
     }
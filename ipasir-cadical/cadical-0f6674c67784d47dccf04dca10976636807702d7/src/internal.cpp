@@ -117,7 +117,9 @@ void Internal::enlarge (int new_max_var) {
   LOG ("enlarge internal size from %zd to new size %zd", vsize, new_vsize);
   // Ordered in the size of allocated memory (larger block first).
   enlarge_only (wtab, 2*new_vsize);
+  enlarge_only (bwtab, 2*new_vsize);
   enlarge_only (vtab, new_vsize);
+  enlarge_only (rtab, new_vsize);
   enlarge_only (links, new_vsize);
   enlarge_zero (btab, new_vsize);
   enlarge_zero (stab, new_vsize);
@@ -135,6 +137,45 @@ void Internal::enlarge (int new_max_var) {
   vsize = new_vsize;
 }
 
+/*------------------------------------------------------------------------*/
+
+// Used by 'Solver::reset' to take over the memory allocated for the tables
+// of the solver which is reset.  These tables are only cleared, such that
+// adding variables up to the previous size does not need to reallocate
+// them.  The clause related memory is released together with 'other'.
+
+template<class T>
+static void reuse_table (vector<T> & dst, vector<T> & src) {
+  assert (dst.empty ());
+  dst.swap (src);
+  dst.clear ();
+}
+
+void Internal::reuse (Internal & other) {
+  assert (!max_var);
+  assert (!vsize);
+  reuse_table (wtab, other.wtab);
+  reuse_table (bwtab, other.bwtab);
+  reuse_table (vtab, other.vtab);
+  reuse_table (rtab, other.rtab);
+  reuse_table (links, other.links);
+  reuse_table (btab, other.btab);
+  reuse_table (stab, other.stab);
+  reuse_table (ptab, other.ptab);
+  reuse_table (ftab, other.ftab);
+  reuse_table (frozentab, other.frozentab);
+  reuse_table (phases.saved, other.phases.saved);
+  reuse_table (phases.target, other.phases.target);
+  reuse_table (phases.best, other.phases.best);
+  reuse_table (phases.prev, other.phases.prev);
+  reuse_table (phases.min, other.phases.min);
+  reuse_table (marks, other.marks);
+  reuse_table (i2e, other.i2e);
+  reuse_table (trail, other.trail);
+  external->e2i.swap (other.external->e2i);
+  external->e2i.clear ();
+}
+
 void Internal::init (int new_max_var) {
   if (new_max_var <= max_var) return;
   if (level) backtrack ();
@@ -571,6 +612,17 @@ int Internal::solve () {
       }
     }
 
+    if (!res && external->importer) {
+      import_clauses ();
+      if (unsat) res = 20;
+      else if (!propagate ()) {
+        LOG ("root level propagation after import produces conflict");
+        learn_empty_clause ();
+        res = 20;
+      }
+    }
+
+    if (!res) collect_contexts ();
     if (!res) res = preprocess ();
     if (!res) res = local_search ();
     if (!res) res = lucky_phases ();
@@ -627,6 +679,9 @@ void Internal::dump () {
 
 /*------------------------------------------------------------------------*/
 
+// Activation literals of open contexts are internal only and thus the
+// clauses of open contexts are traversed without them.
+
 bool Internal::traverse_clauses (ClauseIterator & it) {
   vector<int> eclause;
   if (unsat) return it.clause (eclause);
@@ -639,7 +694,7 @@ bool Internal::traverse_clauses (ClauseIterator & it) {
       if (tmp > 0) { satisfied = true; break; }
       if (tmp < 0) continue;
       const int elit = externalize (ilit);
-      eclause.push_back (elit);
+      if (elit) eclause.push_back (elit);
     }
     if (!satisfied && !it.clause (eclause))
       return false;
@@ -26,6 +26,7 @@ extern "C" {
 // Common 'C++' headers.
 
 #include <algorithm>
+#include <atomic>
 #include <queue>
 #include <string>
 #include <vector>
@@ -66,6 +67,7 @@ extern "C" {
 #include "observer.hpp"
 #include "occs.hpp"
 #include "options.hpp"
+#include "paged.hpp"
 #include "parse.hpp"
 #include "phases.hpp"
 #include "profile.hpp"
@@ -144,7 +146,7 @@ struct Internal {
   bool localsearching;          // true during local search
   bool preprocessing;           // true during preprocessing
   bool force_saved_phase;       // force saved phase in decision
-  bool termination_forced;      // forced to terminate
+  atomic<bool> termination_forced; // forced (asynchronously) to terminate
   bool searching_lucky_phases;  // during 'lucky_phases'
   bool stable;                  // true during stabilization phase
   bool reported;                // reported in this solving call
@@ -163,6 +165,7 @@ struct Internal {
   ScoreSchedule scores;         // score based decision priority queue
   vector<double> stab;          // table of variable scores [1,max_var]
   vector<Var> vtab;             // variable table [1,max_var]
+  vector<Reason> rtab;          // reason table [1,max_var]
   Links links;                  // table of links for decision queue
   vector<Flags> ftab;           // variable and literal flags
   vector<int64_t> btab;         // enqueue time stamps for queue
@@ -172,6 +175,7 @@ struct Internal {
   vector<int64_t> ntab2;        // number of two-sided occurrences table
   vector<Bins> big;             // binary implication graph
   vector<Watches> wtab;         // table of watches for all literals
+  vector<Watches> bwtab;        // table of binary watches for all literals
   Clause * conflict;            // set in 'propagation', reset in 'analyze'
   Clause * ignore;              // ignored during 'vivify_propagate'
   size_t propagated;            // next trail position to propagate
@@ -233,6 +237,7 @@ struct Internal {
   //
   void enlarge_vals (size_t new_vsize);
   void enlarge (int new_max_var);
+  void reuse (Internal & other);        // Take over tables of 'other'.
 
   // A variable is 'active' if it is not eliminated nor fixed.
   //
@@ -296,6 +301,7 @@ struct Internal {
   // Helper functions to access variable and literal data.
   //
   Var & var (int lit)         { return vtab[vidx (lit)]; }
+  Reason & reason (int lit)   { return rtab[vidx (lit)]; }
   Link & link (int lit)       { return links[vidx (lit)]; }
   Flags & flags (int lit)     { return ftab[vidx (lit)]; }
   int64_t & bumped (int lit) { return btab[vidx (lit)]; }
@@ -312,6 +318,7 @@ struct Internal {
   int64_t & noccs (int lit) { assert (!ntab.empty ()); return ntab[vlit (lit)]; }
   int64_t & noccs2 (int lit) { assert (!ntab2.empty ()); return ntab2[vidx (lit)]; }
   Watches & watches (int lit) { assert (!wtab.empty ()); return wtab[vlit (lit)]; }
+  Watches & binaries (int lit) { assert (!bwtab.empty ()); return bwtab[vlit (lit)]; }
 
   // Variable bumping (through exponential VSIDS).
   //
@@ -364,12 +371,14 @@ struct Internal {
   void unmark_clause ();        // unmark 'this->clause'
   void unmark (Clause *);
 
-  // Watch literal 'lit' in clause with blocking literal 'blit'.
-  // Inlined here, since it occurs in the tight inner loop of 'propagate'.
+  // Watch literal 'lit' in clause with blocking literal 'blit'.  Binary
+  // clauses are watched in the separate 'binaries' lists, long clauses in
+  // 'watches'.  Inlined here, since it occurs in the tight inner loop of
+  // 'propagate'.
   //
   inline void watch_literal (int lit, int blit, Clause * c) {
     assert (lit != blit);
-    Watches & ws = watches (lit);
+    Watches & ws = c->size == 2 ? binaries (lit) : watches (lit);
     ws.push_back (Watch (blit, c));
     LOG (c, "watch %d blit %d in", lit, blit);
   }
@@ -387,8 +396,8 @@ struct Internal {
   inline void unwatch_clause (Clause * c) {
     const int l0 = c->literals[0];
     const int l1 = c->literals[1];
-    remove_watch (watches (l0), c);
-    remove_watch (watches (l1), c);
+    remove_watch (c->size == 2 ? binaries (l0) : watches (l0), c);
+    remove_watch (c->size == 2 ? binaries (l1) : watches (l1), c);
   }
 
   // Update queue to point to last potentially still unassigned variable.
@@ -481,6 +490,22 @@ struct Internal {
   int reuse_trail ();
   void restart ();
 
+  // Adding clauses from a connected importer in 'import.cpp'.
+  //
+  void import_clauses ();
+  void import_clauses (const int * lits, size_t size);
+
+  // Splitting the formula into cubes by lookahead in 'cube.cpp'.
+  //
+  int lookahead_probe (int lit);
+  int lookahead_variable ();
+  void split_cube (int depth, vector<int> & cube, vector<vector<int>> &);
+  void generate_cubes (int depth, vector<vector<int>> & cubes);
+
+  // Shrinking blocking clauses during model enumeration in 'enumerate.cpp'.
+  //
+  void enumerate_decisions (vector<int> & lits);
+
   // Functions to set and reset certain 'phases'.
   //
   void clear_phases (vector<Phase> &);  // reset to zero
@@ -535,7 +560,7 @@ struct Internal {
   void remove_falsified_literals (Clause *);
   void mark_satisfied_clauses_as_garbage ();
   void copy_clause (Clause *);
-  void flush_watches (int lit, Watches &);
+  void flush_watches (int lit);
   size_t flush_occs (int lit);
   void flush_all_occs_and_watches ();
   void copy_non_garbage_clauses ();
@@ -559,7 +584,6 @@ struct Internal {
 
   // Operators on watches.
   //
-  void sort_watches ();
   void connect_watches (bool irredundant_only = false);
   void disconnect_watches ();
 
@@ -605,6 +629,13 @@ struct Internal {
   bool compacting ();
   void compact ();
 
+  // Internal only activation variables of contexts and collecting
+  // satisfied clauses of popped contexts in 'context.cpp'
+  //
+  int new_activation_variable ();
+  bool internal_only (Clause *) const;
+  void collect_contexts ();
+
   // Transitive reduction of binary implication graph in 'transred.cpp'
   //
   void transred ();
@@ -823,6 +854,7 @@ struct Internal {
   void reset_assumptions ();            // Reset after 'solve' call.
   void reset_limits ();                 // Reset after 'solve' call.
   void failing ();                      // Prepare failed assumptions.
+  int propagate_assumptions ();         // Without search (zero or '20').
 
   bool failed (int lit) {               // Literal failed assumption?
     Flags & f = flags (lit);
@@ -937,6 +969,15 @@ struct Internal {
     return res;
   }
 
+  // Activation literals of contexts are not mapped to external literals.
+  //
+  bool internal_only (int lit) const {
+    assert (lit != INT_MIN);
+    const int idx = abs (lit);
+    assert (idx), assert (idx <= max_var);
+    return !i2e[idx];
+  }
+
   // Explicit freezing and melting of variables.
   //
   void freeze (int lit) {
@@ -1070,7 +1111,7 @@ struct Internal {
   void warning (const char *, ...);
 
   static void fatal_message_start ();
-  void fatal_message_end ();
+  static void fatal_message_end ();
 };
 
 /*------------------------------------------------------------------------*/
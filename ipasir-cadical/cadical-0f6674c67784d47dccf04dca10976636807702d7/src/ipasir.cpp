@@ -1,6 +1,8 @@
 #include "ipasir.h"
 #include "ccadical.h"
 
+#include <climits>
+
 extern "C" {
 
 const char * ipasir_signature () {
@@ -18,6 +20,10 @@ void ipasir_add (void * solver, int lit) {
   ccadical_add ((CCaDiCaL *) solver, lit);
 }
 
+void ipasir_add_clauses (void * solver, const int * lits, int size) {
+  ccadical_add_clauses ((CCaDiCaL *) solver, lits, size);
+}
+
 void ipasir_assume (void * solver, int lit) {
   ccadical_assume ((CCaDiCaL *) solver, lit);
 }
@@ -30,18 +36,93 @@ int ipasir_val (void * solver, int lit) {
   return ccadical_val ((CCaDiCaL *) solver, lit);
 }
 
+void ipasir_val_range (void * solver, int from, int to, int * vals) {
+  ccadical_val_range ((CCaDiCaL *) solver, from, to, vals);
+}
+
+void ipasir_model (void * solver, int from, int to, signed char * vals) {
+  ccadical_model ((CCaDiCaL *) solver, from, to, vals);
+}
+
 int ipasir_failed (void * solver, int lit) {
   return ccadical_failed ((CCaDiCaL *) solver, lit);
 }
 
+int ipasir_failed_core (void * solver, int * core, int size) {
+  return ccadical_failed_core ((CCaDiCaL *) solver, core, size);
+}
+
 void ipasir_set_terminate (void * solver,
                            void * state, int (*terminate)(void * state)) {
   ccadical_set_terminate ((CCaDiCaL *) solver, state, terminate);
 }
 
-void ipasir_set_learn (void * /*solver*/, void * /*state*/, int /*max_length*/,
-                       void (* /*learn*/)(void * state, int * clause)) {
-  // not implemented yet
+void ipasir_set_learn (void * solver,
+                       void * state, int max_length,
+                       void (*learn)(void * state, int * clause)) {
+  ccadical_set_learn ((CCaDiCaL *) solver, state, max_length, learn);
+}
+
+void ipasir_set_learn_batch (void * solver,
+                             void * state, int max_length,
+                             void (*learn)(void * state,
+                                           const int * clauses, int size)) {
+  ccadical_set_learn_batch ((CCaDiCaL *) solver,
+                            state, max_length, INT_MAX, learn);
+}
+
+void ipasir_set_import (void * solver,
+                        void * state,
+                        const int * (*import)(void * state, int * size)) {
+  ccadical_set_import ((CCaDiCaL *) solver, state, import);
+}
+
+void ipasir_set_terminate_interval (void * solver,
+                                    int conflicts, int milliseconds) {
+  ccadical_set_terminate_interval ((CCaDiCaL *) solver,
+                                   conflicts, milliseconds);
+}
+
+void ipasir_interrupt (void * solver) {
+  ccadical_terminate ((CCaDiCaL *) solver);
+}
+
+int ipasir_propagate (void * solver, const int * assumptions, int size,
+                      int * implied, int capacity) {
+  return ccadical_propagate ((CCaDiCaL *) solver, assumptions, size,
+                             implied, capacity);
+}
+
+int ipasir_backbone (void * solver, int * backbone, int size) {
+  return ccadical_backbone ((CCaDiCaL *) solver, backbone, size);
+}
+
+int ipasir_shrink_core (void * solver) {
+  return ccadical_shrink_core ((CCaDiCaL *) solver);
+}
+
+int ipasir_enumerate (void * solver, const int * projection, int size,
+                      int64_t limit, void * state,
+                      void (*models)(void * state,
+                                     const int * models, int size)) {
+  return ccadical_enumerate ((CCaDiCaL *) solver, projection, size,
+                             limit, state, models);
+}
+
+void ipasir_push (void * solver) {
+  ccadical_push ((CCaDiCaL *) solver);
+}
+
+void ipasir_pop (void * solver) {
+  ccadical_pop ((CCaDiCaL *) solver);
+}
+
+void ipasir_reset (void * solver) {
+  ccadical_clear ((CCaDiCaL *) solver);
+}
+
+void ipasir_pool (int size) {
+  ccadical_pool (size);
 }
 
 }
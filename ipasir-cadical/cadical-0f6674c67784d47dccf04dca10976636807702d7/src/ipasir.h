@@ -7,6 +7,8 @@ extern "C" {
 #endif
 /*------------------------------------------------------------------------*/
 
+#include <stdint.h>
+
 // Here are the declarations for the actual IPASIR functions, which is the
 // generic incremental reentrant SAT solver API used for instance in the SAT
 // competition.  The other 'C' API in 'ccadical.h' is (more) type safe and
@@ -27,6 +29,137 @@ void ipasir_set_terminate (void * solver,
 void ipasir_set_learn (void * solver, void * state, int max_length,
                        void (*learn)(void * state, int * clause));
 
+/*------------------------------------------------------------------------*/
+
+// Non-IPASIR conformant extensions shared by all solvers packaged together
+// with this library.  They allow to exchange data with the solver in bulk
+// and thus avoid the overhead of one call per literal, which is substantial
+// if the solver is used through a foreign function interface.
+
+// Same as calling 'ipasir_add' on 'lits[0]', ..., 'lits[size-1]'.
+//
+void ipasir_add_clauses (void * solver, const int * lits, int size);
+
+// Same as 'vals[i] = ipasir_val (solver, from + i)' for all variables from
+// 'from' to 'to' (inclusive) respectively only the sign of those values.
+//
+void ipasir_val_range (void * solver, int from, int to, int * vals);
+void ipasir_model (void * solver, int from, int to, signed char * vals);
+
+// Write at most 'size' failed assumptions to 'core' and return the number
+// of all failed assumptions, i.e., those for which 'ipasir_failed' holds,
+// where assumptions given several times are only counted once.
+//
+int ipasir_failed_core (void * solver, int * core, int size);
+
+// Same as 'ipasir_set_learn' except that learned clauses are collected and
+// passed on in batches.  Each batch consists of 'size' literals forming
+// zero terminated clauses in the format of 'ipasir_add_clauses'.  Pending
+// clauses are passed on before 'ipasir_solve' returns.  This replaces the
+// call-back set with 'ipasir_set_learn' and vice versa.
+//
+void ipasir_set_learn_batch (void * solver, void * state, int max_length,
+                             void (*learn)(void * state,
+                                           const int * clauses, int size));
+
+// Set call-back polled regularly (on restarts) for clauses to be added as
+// learned clauses, e.g., clauses learned by other solvers on the same
+// formula.  It returns a buffer of '*size' literals forming zero terminated
+// clauses in the format of 'ipasir_add_clauses' (or sets '*size' to zero),
+// which only has to stay valid until the next call.  The clauses have to be
+// implied by the formula.  Clauses over variables unknown to the solver are
+// ignored.
+//
+void ipasir_set_import (void * solver, void * state,
+                        const int * (*import)(void * state, int * size));
+
+// Poll the call-back set with 'ipasir_set_terminate' only after 'conflicts'
+// checks for termination, which happen at least once per conflict, or if
+// 'milliseconds' passed since the last poll.  Non-positive values disable
+// the respective condition.  By default the call-back is polled on every
+// check, which for calls through a foreign function interface is costly.
+//
+void ipasir_set_terminate_interval (void * solver,
+                                    int conflicts, int milliseconds);
+
+// Ask the running 'ipasir_solve' to return zero as soon as possible, or
+// the next one if the solver is not solving.  This can be called from any
+// other thread (or a signal handler) since it only sets an atomic flag,
+// which is checked before the call-back of 'ipasir_set_terminate'.
+//
+void ipasir_interrupt (void * solver);
+
+// Only propagate the 'size' literals in 'assumptions' (and those assumed
+// before with 'ipasir_assume') without searching.  Writes at most
+// 'capacity' of the literals implied by them (including the assumptions
+// themselves) to 'implied' and returns the number of all of them, or '-1'
+// if propagation runs into a conflict.  Literals fixed at the root level
+// are not included.  Afterwards all assumptions are reset.
+//
+int ipasir_propagate (void * solver, const int * assumptions, int size,
+                      int * implied, int capacity);
+
+// Only provided by CaDiCaL.  Computes the backbone under the assumptions
+// added with 'ipasir_assume' in one call.  Writes at most 'size' backbone
+// literals sorted by variable to 'backbone' and returns the number of all
+// of them, which is at most the maximum variable.  Returns '-1' if the
+// formula is unsatisfiable under the assumptions (then 'ipasir_failed' can
+// be used) and '-2' if interrupted.  Afterwards all assumptions are reset.
+//
+int ipasir_backbone (void * solver, int * backbone, int size);
+
+// Only provided by CaDiCaL.  Shrinks the failed assumptions of the last
+// unsatisfiable 'ipasir_solve' call by solving under subsets of them with a
+// conflict limit (option 'shrinkcorelim') and returns the size of the new
+// core.  Afterwards 'ipasir_failed' and 'ipasir_failed_core' only give the
+// smaller core.  Setting option 'shrinkcore' with 'ccadical_set_option'
+// does this after each unsatisfiable 'ipasir_solve' call.
+//
+int ipasir_shrink_core (void * solver);
+
+// Only provided by CaDiCaL.  Enumerates the models of the formula under
+// the assumptions added with 'ipasir_assume' projected on the 'size'
+// variables in 'projection' (all variables if 'size' is zero).  Each model
+// is given by the literals of these variables in the same order followed by
+// a terminating zero.  Models are passed on to 'models' in batches of one
+// or more models, with 'size' the number of literals of the batch
+// including the zeros.  Each projected model is passed only once.  Blocking
+// clauses only contain the literals not implied by earlier literals of the
+// projected model.  They are guarded by an internal variable, which is not
+// a variable of the application, and are removed at the end.
+// Returns '20' if all models have been enumerated, '10' if 'limit' models
+// (if positive) have been enumerated and zero if interrupted.  Afterwards
+// all assumptions are reset.
+//
+int ipasir_enumerate (void * solver, const int * projection, int size,
+                      int64_t limit, void * state,
+                      void (*models)(void * state,
+                                     const int * models, int size));
+
+// Only provided by CaDiCaL.  Opens a new context.  All clauses added until
+// the matching 'ipasir_pop' are removed again by it.  Contexts nest and
+// are assumed in every 'ipasir_solve' call while open.  Contexts do not
+// use any variable of the application.
+//
+void ipasir_push (void * solver);
+
+// Only provided by CaDiCaL.  Removes the clauses of the innermost context.
+//
+void ipasir_pop (void * solver);
+
+// Only provided by CaDiCaL.  Resets the solver to the state after
+// 'ipasir_init' except that options set before are kept and the memory
+// allocated for variables is reused.  All clauses, assumptions and
+// call-backs are removed.
+//
+void ipasir_reset (void * solver);
+
+// Only provided by CaDiCaL.  Keeps at most 'size' solvers released by
+// 'ipasir_release' (after resetting them to default options) for reuse by
+// 'ipasir_init'.  By default no solvers are kept (zero 'size').
+//
+void ipasir_pool (int size);
+
 /*------------------------------------------------------------------------*/
 #ifdef __cplusplus
 }
@@ -20,13 +20,16 @@ double Internal::scale (double v) const {
 
 bool Internal::terminating () {
 
-  if (external->terminator && external->terminator->terminate ()) {
-    LOG ("connected terminator forces termination");
+  // Checked first since it is cheap and set asynchronously by
+  // 'Solver::terminate' without any call-back.
+  //
+  if (termination_forced.load (memory_order_relaxed)) {
+    LOG ("termination forced");
     return true;
   }
 
-  if (termination_forced) {
-    LOG ("termination forced");
+  if (external->terminator && external->terminator->terminate ()) {
+    LOG ("connected terminator forces termination");
     return true;
   }
 
@@ -43,7 +43,7 @@ struct Last {
   struct { int64_t propagations, reductions; } probe;
   struct { int64_t conflicts; } reduce, rephase;
   struct { int64_t marked; } ternary;
-  struct { int64_t fixed; } collect;
+  struct { int64_t fixed, popped; } collect;
   Last ();
 };
 
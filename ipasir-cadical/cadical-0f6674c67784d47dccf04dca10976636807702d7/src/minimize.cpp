@@ -18,16 +18,19 @@ bool Internal::minimize_literal (int lit, int depth) {
   Flags & f = flags (lit);
   Var & v = var (lit);
   if (!v.level || f.removable || f.keep) return true;
-  if (!v.reason || f.poison || v.level == level) return false;
+  if (f.poison || v.level == level) return false;
   const Level & l = control[v.level];
   if (!depth && l.seen.count < 2) return false;   // Don Knuth's idea
   if (v.trail <= l.seen.trail) return false;      // new early abort
   if (depth > opts.minimizedepth) return false;
+  // The reason is in a separate table and thus only accessed after the
+  // cheaper checks above on 'v' and 'f' did not abort.
+  Clause * reason = rtab[vidx (lit)].clause;
+  if (!reason) return false;                      // decision
   bool res = true;
-  assert (v.reason);
-  const const_literal_iterator end = v.reason->end ();
+  const const_literal_iterator end = reason->end ();
   const_literal_iterator i;
-  for (i = v.reason->begin (); res && i != end; i++) {
+  for (i = reason->begin (); res && i != end; i++) {
     const int other = *i;
     if (other == lit) continue;
     res = minimize_literal (-other, depth + 1);
@@ -16,12 +16,11 @@ int Options::report_default_value;
 // The order of initializations of static objects is undefined and thus we
 // can not assume that this table is already initialized if a solver and
 // thus the constructor of 'Options' is called.  Therefore we just have to
-// reinitialize this table in every call to 'Options::Options'.  This does
-// not produce a data race even for parallel initialization since the
-// same values are written by all threads under the assumption that the
-// 'report_default_value' is set before any solver is initialized.  We do
-// have to perform this static initialization though, since 'has' is
-// static and does not require that the 'Options' constructor was called.
+// reinitialize this table when the first solver is initialized (see
+// 'Options::Options' below), which assumes that 'report_default_value' is
+// set before any solver is initialized.  We do have to perform this static
+// initialization though, since 'has' is static and does not require that
+// the 'Options' constructor was called.
 
 Option Options::table [] = {
 #define OPTION(N,V,L,H,O,D) \
@@ -139,9 +138,18 @@ void Options::initialize_from_environment (
   if (val > H) val = H;
 }
 
-// Initialize all the options to their default value 'V'.
+// Initialize all the options to their default value 'V'.  This happens
+// without an 'Internal' solver (see below) and thus inconsistencies in
+// 'options.hpp' are reported with the static 'fatal_message_*' functions.
 
-Options::Options (Internal * s) : internal (s)
+#define OPTIONS_FATAL(...) \
+do { \
+  Internal::fatal_message_start (); \
+  fprintf (stderr, __VA_ARGS__); \
+  Internal::fatal_message_end (); \
+} while (0)
+
+Options::Options () : internal (0)
 {
   assert (number_of_options == sizeof Options::table / sizeof (Option));
 
@@ -152,13 +160,14 @@ Options::Options (Internal * s) : internal (s)
 # define OPTION(N,V,L,H,O,D) \
   do { \
     if ((L) > (V)) \
-      FATAL ("'" #N "' default '" #V "' " \
+      OPTIONS_FATAL ("'" #N "' default '" #V "' " \
         "lower minimum '" #L "' in 'options.hpp'"); \
     if ((H) < (V)) \
-      FATAL ("'" #N "' default '" #V "' " \
+      OPTIONS_FATAL ("'" #N "' default '" #V "' " \
         "larger maximum '" #H "' in 'options.hpp'"); \
     if (strcmp (prev, #N) > 0)  \
-      FATAL ("'%s' ordered before '" #N "' in 'options.hpp'", prev); \
+      OPTIONS_FATAL ("'%s' ordered before '" #N "' in 'options.hpp'", \
+        prev); \
     N = (int)(V); \
     assert (&val (i) == &N); \
     /* The order of initializing static data is undefined and thus */ \
@@ -190,6 +199,28 @@ Options::Options (Internal * s) : internal (s)
 # undef OPTION
 }
 
+// Looking up all options in the environment takes one 'getenv' call per
+// option, each scanning the whole environment, which made up most of the
+// time to create (and delete) a solver.  This matters for applications
+// using many solvers on small formulas.  Thus the initial values are only
+// computed once by the constructor above for the first solver (static
+// local variables are initialized thread-safe) and then just copied.  As a
+// consequence changing the environment after the first solver has been
+// created has no effect.
+
+Options::Options (Internal * s) : internal (s)
+{
+  static const Options initial;
+  initial.copy (*this);
+}
+
+void Options::copy (Options & other) const {
+  const int * src = &__start_of_options__ + 1;
+  int * dst = &other.__start_of_options__ + 1;
+  for (size_t i = 0; i < number_of_options; i++)
+    dst[i] = src[i];
+}
+
 /*------------------------------------------------------------------------*/
 
 void Options::set (Option * o, int new_val) {
@@ -18,8 +18,10 @@
 \
 OPTION( arena,             1,  0,  1, 0, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1, 0, "keep clauses compact") \
+OPTION( arenanursery,      1,  0,  1, 0, "learned clauses in nursery") \
 OPTION( arenasort,         1,  0,  1, 0, "sort clauses in arena") \
 OPTION( arenatype,         3,  1,  3, 0, "1=clause, 2=var, 3=queue") \
+OPTION( backbonechunk,    32,  1,1e5, 0, "backbone candidates at once") \
 OPTION( binary,            1,  0,  1, 0, "use binary proof format") \
 OPTION( block,             0,  0,  1, 0, "blocked clause elimination") \
 OPTION( blockmaxclslim,  1e3,  1,1e9, 1, "maximum clause size") \
@@ -46,6 +48,10 @@ OPTION( cover,             0,  0,  1, 0, "covered clause elimination") \
 OPTION( covermaxeff,     1e8,  0,1e9, 1, "maximum cover efficiency") \
 OPTION( covermineff,     1e6,  0,1e9, 1, "minimum cover efficiency") \
 OPTION( coverreleff,       4,  0,1e3, 1, "relative efficiency per mille") \
+OPTION( cube,              0,  0,  1, 0, "cube-and-conquer on threads") \
+OPTION( cubecands,        32,  1,1e4, 0, "lookahead candidates per split") \
+OPTION( cubedepth,         6,  1, 20, 0, "maximum number of splits") \
+OPTION( cubethreads,       0,  0,1e3, 0, "number of threads (0=all cores)") \
 OPTION( decompose,         1,  0,  1, 0, "decompose BIG in SCCs and ELS") \
 OPTION( decomposerounds,   2,  1, 16, 0, "number of decompose rounds") \
 OPTION( deduplicate,       1,  0,  1, 0, "remove duplicated binary clauses") \
@@ -91,7 +97,10 @@ LOGOPT( logsort,           0,  0,  1, 0, "sort logged clauses") \
 OPTION( lucky,             1,  0,  1, 0, "search for lucky phases") \
 OPTION( minimize,          1,  0,  1, 0, "minimize learned clauses") \
 OPTION( minimizedepth,   1e3,  0,1e3, 0, "minimization depth") \
+OPTION( parsethreads,      0,  0,1e3, 0, "parser threads (0=all cores)") \
 OPTION( phase,             1,  0,  1, 0, "initial phase") \
+OPTION( popcollect,      1e2,  0,1e9, 0, "collect after popped contexts") \
+OPTION( prefetch,          0,  0, 64, 0, "prefetch distance in propagation") \
 OPTION( probe,             1,  0,  1, 0, "failed literal probing" ) \
 OPTION( probehbr,          1,  0,  1, 0, "learn hyper binary clauses") \
 OPTION( probeint,        5e3,  1,1e9, 0, "probing interval" ) \
@@ -124,11 +133,14 @@ OPTION( reverse,           0,  0,  1, 0, "reverse variable ordering") \
 OPTION( score,             1,  0,  1, 0, "use EVSIDS scores") \
 OPTION( scorefactor,     950,500,1e3, 0, "score factor per mille") \
 OPTION( seed,              0,  0,1e9, 0, "random seed") \
+OPTION( shrinkcore,        0,  0,  1, 0, "shrink failed assumption cores") \
+OPTION( shrinkcorelim,   1e3,  0,1e9, 0, "conflicts per core shrinking call") \
 OPTION( shuffle,           0,  0,  1, 0, "shuffle variables") \
 OPTION( shufflequeue,      1,  0,  1, 0, "shuffle variable queue") \
 OPTION( shufflerandom,     0,  0,  1, 0, "not reverse but random") \
 OPTION( shufflescores,     1,  0,  1, 0, "shuffle variable scores") \
 OPTION( simplify,          1,  0,  1, 0, "enable simplifier") \
+OPTION( sparse,            0,  0,  1, 0, "sparse external variables") \
 OPTION( stabilize,         1,  0,  1, 0, "enable stabilizing phases") \
 OPTION( stabilizefactor, 200,101,1e9, 0, "phase increase in percent") \
 OPTION( stabilizeint,    1e3,  1,1e9, 0, "stabilizing interval") \
@@ -152,6 +164,10 @@ OPTION( ternarymineff,   1e6,  1,1e9, 1, "minimum ternary efficiency") \
 OPTION( ternaryocclim,   1e2,  1,1e9, 1, "ternary occurrence limit") \
 OPTION( ternaryreleff,    10,  0,1e5, 1, "relative efficiency in per mille") \
 OPTION( ternaryrounds,     2,  1, 16, 0, "maximum ternary rounds") \
+OPTION( tiny,              1,  0,  1, 0, "tiny formula engine in C API") \
+OPTION( tinyclauses,     1e3,  0,1e5, 0, "maximum tiny formula clauses") \
+OPTION( tinyeffort,      2e4,  0,1e9, 0, "tiny occurrences per solve") \
+OPTION( tinyvars,        200,  1,256, 0, "maximum tiny formula variable") \
 OPTION( transred,          1,  0,  1, 0, "transitive reduction of BIG") \
 OPTION( transredmaxeff,  1e8,  0,1e9, 1, "maximum efficiency") \
 OPTION( transredmineff,  1e6,  0,1e9, 1, "minimum efficiency") \
@@ -233,6 +249,8 @@ class Options {
   static void initialize_from_environment (
     int & val, const char * name, const int L, const int H);
 
+  Options ();                   // Defaults and environment values.
+
 public:
   
   // For library usage we disable reporting by default while for the stand
@@ -278,6 +296,7 @@ public:
   int  get (const char * name);         // Get current value.
 
   void config (const char * name);      // Configuration.
+  void copy (Options & other) const;    // Copy values to 'other'.
 
   void print ();             // Print current values in command line form
   static void usage ();      // Print usage message for all options.
@@ -0,0 +1,77 @@
+#ifndef _paged_hpp_INCLUDED
+#define _paged_hpp_INCLUDED
+
+#include <climits>
+#include <vector>
+
+namespace CaDiCaL {
+
+// Two-level table for the per-variable data of 'External' indexed by
+// external variables.  These indices are chosen by the user and might be
+// sparse, e.g., a few thousand variables with indices up to '10^8'.  Pages
+// of 'page' consecutive entries are only allocated when one of their
+// entries is written through 'ref', such that memory scales with the
+// number of used variables (actually used pages) and not with the maximum
+// variable index.  Entries of missing pages read as zero (default value).
+//
+// Loops over all variables should use 'next' to skip missing pages:
+//
+//   for (int idx = 1; idx <= max_var; idx = table.next (idx))
+//     ...
+//
+// For densely used indices all pages are allocated and the table behaves
+// like a vector with one additional indirection.
+
+template<class T> class Paged {
+
+  static const unsigned bits = 8;
+  static const unsigned page = 1u << bits;
+  static const unsigned mask = page - 1;
+
+  std::vector<T *> pages;
+
+public:
+
+  Paged () { }
+  ~Paged () { for (const auto & p : pages) delete [] p; }
+
+  Paged (const Paged &) = delete;
+  Paged & operator = (const Paged &) = delete;
+
+  T operator [] (int idx) const {
+    const unsigned i = (unsigned) idx >> bits;
+    if (i >= pages.size () || !pages[i]) return T ();
+    return pages[i][idx & mask];
+  }
+
+  T & ref (int idx) {
+    const unsigned i = (unsigned) idx >> bits;
+    if (i >= pages.size ()) pages.resize (i + 1, 0);
+    T * & p = pages[i];
+    if (!p) p = new T[page] ();
+    return p[idx & mask];
+  }
+
+  // Next index after 'idx' in an allocated page or 'INT_MAX' if none.
+
+  int next (int idx) const {
+    unsigned i = (unsigned) ++idx >> bits;
+    if (i < pages.size () && pages[i]) return idx;
+    while (++i < pages.size ())
+      if (pages[i]) return i << bits;
+    return INT_MAX;
+  }
+
+  // Resets all entries to zero but keeps the allocated pages.
+
+  void clear () {
+    for (const auto & p : pages)
+      if (p) for (unsigned i = 0; i < page; i++) p[i] = T ();
+  }
+
+  void swap (Paged & other) { pages.swap (other.pages); }
+};
+
+}
+
+#endif
@@ -1,5 +1,9 @@
 #include "internal.hpp"
 
+// Threads are only used to tokenize mapped files in parallel.
+
+#include <thread>
+
 /*------------------------------------------------------------------------*/
 
 namespace CaDiCaL {
@@ -71,6 +75,117 @@ Parser::parse_lit (int & ch, int & lit, const int vars, int strict) {
 
 /*------------------------------------------------------------------------*/
 
+// Fast path for the body of mapped DIMACS files.  The mapped file is split
+// at new-lines into chunks, which are tokenized independently (and in
+// parallel by 'opts.parsethreads' threads) without going through 'get'.
+// The literals of each round of chunks are then added in order.  Since
+// only well-formed chunks are added, parse errors are detected, but not
+// reported, and the caller simply parses the rest of the file with the
+// standard character based parser from the first failing chunk on, which
+// then produces the same error message with the same line number.
+
+static const size_t parse_chunk_size = 1 << 22;
+
+// Returns 'false' on any syntax error or literal exceeding 'vars'.
+
+static bool tokenize_chunk (const char * p, const char * end,
+                            int vars, int strict,
+                            vector<int> & lits, int64_t & lines) {
+  lits.clear ();
+  lines = 0;
+  while (p < end) {
+    int ch = (unsigned char) *p++;
+    if (ch == '\n') { lines++; continue; }
+    if (ch == ' ' || ch == '\t' || ch == '\r') continue;
+    if (ch == 'c') {
+      while (p < end && *p != '\n') p++;
+      continue;
+    }
+    int sign = 1;
+    if (ch == '-') {
+      if (p == end) return false;
+      ch = (unsigned char) *p++;
+      sign = -1;
+    }
+    if (!isdigit (ch)) return false;
+    int lit = ch - '0';
+    while (p < end && isdigit (ch = (unsigned char) *p)) {
+      const int digit = ch - '0';
+      if (INT_MAX/10 < lit || INT_MAX - digit < 10*lit) return false;
+      lit = 10*lit + digit;
+      p++;
+    }
+    if (p < end && *p == '\r') p++;
+    if (p < end) {
+      ch = (unsigned char) *p;
+      if (ch == 'c') {
+        while (p < end && *p != '\n') p++;
+        if (p == end) return false;       // end-of-file in comment
+      } else if (ch != ' ' && ch != '\t' && ch != '\n') return false;
+    }
+    if (lit > vars && strict > 0) return false;
+    lits.push_back (sign * lit);
+  }
+  return true;
+}
+
+void Parser::parse_mapped_clauses (int vars, int strict, int clauses,
+                                   int & lit, int & parsed) {
+  assert (file->mapped ());
+  size_t threads = internal->opts.parsethreads;
+  if (!threads) threads = max (1u, thread::hardware_concurrency ());
+  struct Chunk {
+    const char * begin, * end;
+    vector<int> lits;
+    int64_t lines;
+    bool ok;
+  };
+  vector<Chunk> chunks;
+  for (;;) {
+    size_t bytes;
+    const char * p = file->remaining (bytes);
+    const char * end = p + bytes;
+    if (p == end) break;
+    chunks.clear ();
+    while (p < end && chunks.size () < threads) {
+      const char * q = p + min (parse_chunk_size, (size_t) (end - p));
+      while (q < end && q[-1] != '\n') q++;
+      chunks.push_back (Chunk { p, q, vector<int> (), 0, false });
+      p = q;
+    }
+    auto tokenize = [vars, strict] (Chunk * c) {
+      c->ok = tokenize_chunk (c->begin, c->end, vars, strict,
+                              c->lits, c->lines);
+    };
+    if (chunks.size () == 1) tokenize (&chunks[0]);
+    else {
+      vector<thread> workers;
+      for (size_t i = 1; i < chunks.size (); i++)
+        workers.emplace_back (tokenize, &chunks[i]);
+      tokenize (&chunks[0]);
+      for (auto & worker : workers)
+        worker.join ();
+    }
+    for (const auto & c : chunks) {
+      if (!c.ok) return;
+      if (strict > 0) {
+        int64_t zeros = 0;
+        for (const auto & other : c.lits)
+          if (!other) zeros++;
+        if (parsed + zeros > clauses) return;
+      }
+      for (const auto & other : c.lits) {
+        lit = other;
+        solver->add (lit);
+        if (!lit) parsed++;
+      }
+      file->skip (c.end - c.begin, c.lines);
+    }
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 // Parsing CNF in DIMACS format.
 
 const char * Parser::parse_dimacs_non_profiled (int & vars, int strict) {
@@ -152,6 +267,8 @@ const char * Parser::parse_dimacs_non_profiled (int & vars, int strict) {
   //
   // external->init (vars);
   int lit = 0, parsed = 0;
+  if (file->mapped ())
+    parse_mapped_clauses (vars, strict, clauses, lit, parsed);
   while ((ch = parse_char ()) != EOF) {
     if (ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r') continue;
     if (ch == 'c') {
@@ -24,6 +24,8 @@ class Parser {
   const char * parse_string (const char * str, char prev);
   const char * parse_positive_int (int & ch, int & res, const char * name);
   const char * parse_lit (int & ch, int & lit, const int vars, int strict);
+  void parse_mapped_clauses (int vars, int strict, int clauses,
+                             int & lit, int & parsed);
   const char * parse_dimacs_non_profiled (int & vars, int strict);
   const char * parse_solution_non_profiled ();
 
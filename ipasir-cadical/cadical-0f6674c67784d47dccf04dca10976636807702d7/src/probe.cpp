@@ -38,8 +38,8 @@ int Internal::probe_dominator (int a, int b) {
   assert (u->level == 1), assert (v->level == 1);
   while (l != k) {
     if (u->trail > v->trail) swap (l, k), swap (u, v);
-    if (!u->parent) return l;
-    int parent = v->parent;
+    if (!reason (l).parent) return l;
+    int parent = reason (k).parent;
     if (k < 0) parent = -parent;
     assert  (parent), assert (val (parent) > 0);
     v = &var (k = parent);
@@ -165,7 +165,7 @@ inline void Internal::probe_assign (int lit, int parent) {
   v.level = level;
   v.trail = (int) trail.size ();
   const signed_char tmp = sign (lit);
-  v.parent = tmp < 0 ? -parent : parent;
+  rtab[idx].parent = tmp < 0 ? -parent : parent;
   if (!level) learn_unit_clause (lit);
   else assert (level == 1);
   vals[idx] = tmp;
@@ -217,9 +217,8 @@ inline void Internal::probe_propagate2 () {
   while (propagated2 != trail.size ()) {
     const int lit = -trail[propagated2++];
     LOG ("probe propagating %d over binary clauses", -lit);
-    Watches & ws = watches (lit);
+    Watches & ws = binaries (lit);
     for (const auto & w : ws) {
-      if (!w.binary ()) continue;
       const int b = val (w.blit);
       if (b > 0) continue;
       if (b < 0) conflict = w.clause;                   // but continue
@@ -242,7 +241,6 @@ bool Internal::probe_propagate () {
       size_t i = 0, j = 0;
       while (i != ws.size ()) {
         const Watch w = ws[j++] = ws[i++];
-        if (w.binary ()) continue;
         const int b = val (w.blit);
         if (b > 0) continue;
         if (w.clause->garbage) continue;
@@ -328,7 +326,7 @@ void Internal::failed_literal (int failed) {
   vector<int> parents;
   int parent = uip;
   while (parent != failed) {
-    int next = var (parent).parent;
+    int next = reason (parent).parent;
     if (parent < 0) next = -next;
     parent = next;
     assert (parent);
@@ -588,7 +586,7 @@ bool Internal::probe_round () {
     if (!propagate ()) {
       LOG ("propagating units after probing results in empty clause");
       learn_empty_clause ();
-    } else sort_watches ();
+    }
   }
 
   int failed = stats.failed - old_failed;
@@ -64,6 +64,7 @@ PROFILE(reduce,3) \
 PROFILE(restart,3) \
 PROFILE(restore,2) \
 PROFILE(search,1) \
+PROFILE(shrink,2) \
 PROFILE(solve,0) \
 PROFILE(stable,2) \
 PROFILE(preprocess,2) \
@@ -44,15 +44,23 @@ void Internal::close_trace () {
 
 /*------------------------------------------------------------------------*/
 
-Proof::Proof (Internal * s) : internal (s) { LOG ("PROOF new"); }
+Proof::Proof (Internal * s) : internal (s), hidden (false) {
+  LOG ("PROOF new");
+}
 
 Proof::~Proof () { LOG ("PROOF delete"); }
 
 /*------------------------------------------------------------------------*/
 
+// Clauses with activation literals of contexts, which are internal only,
+// are not traced at all.  They are only used under the assumption of their
+// activation literals and thus clauses derived from them contain those too
+// (see 'context.cpp').
+
 inline void Proof::add_literal (int internal_lit) {
   const int external_lit = internal->externalize (internal_lit);
-  clause.push_back (external_lit);
+  if (external_lit) clause.push_back (external_lit);
+  else hidden = true;
 }
 
 inline void Proof::add_literals (Clause * c) {
@@ -157,23 +165,32 @@ void Proof::strengthen_clause (Clause * c, int remove) {
 
 void Proof::add_original_clause () {
   LOG (clause, "PROOF adding original external clause");
-  for (size_t i = 0; i < observers.size (); i++)
-    observers[i]->add_original_clause (clause);
+  if (hidden) LOG ("PROOF skipping clause with internal only literals");
+  else
+    for (size_t i = 0; i < observers.size (); i++)
+      observers[i]->add_original_clause (clause);
   clause.clear ();
+  hidden = false;
 }
 
 void Proof::add_derived_clause () {
   LOG (clause, "PROOF adding derived external clause");
-  for (size_t i = 0; i < observers.size (); i++)
-    observers[i]->add_derived_clause (clause);
+  if (hidden) LOG ("PROOF skipping clause with internal only literals");
+  else
+    for (size_t i = 0; i < observers.size (); i++)
+      observers[i]->add_derived_clause (clause);
   clause.clear ();
+  hidden = false;
 }
 
 void Proof::delete_clause () {
   LOG (clause, "PROOF deleting external clause");
-  for (size_t i = 0; i < observers.size (); i++)
-    observers[i]->delete_clause (clause);
+  if (hidden) LOG ("PROOF skipping clause with internal only literals");
+  else
+    for (size_t i = 0; i < observers.size (); i++)
+      observers[i]->delete_clause (clause);
   clause.clear ();
+  hidden = false;
 }
 
 }
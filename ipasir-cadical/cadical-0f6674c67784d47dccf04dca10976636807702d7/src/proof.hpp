@@ -19,6 +19,7 @@ class Proof {
   Internal * internal;
 
   vector<int> clause;           // of external literals
+  bool hidden;                  // 'clause' has internal only literals
   vector<Observer *> observers; // owned, so deleted in destructor
 
   void add_literal (int internal_lit);  // add to 'clause'
@@ -67,7 +67,7 @@ inline void Internal::search_assign (int lit, Clause * reason) {
 
   v.level = lit_level;
   v.trail = (int) trail.size ();
-  v.reason = reason;
+  rtab[idx].clause = reason;
   if (!lit_level) learn_unit_clause (lit);  // increases 'stats.fixed'
   const signed_char tmp = sign (lit);
   vals[idx] = tmp;
@@ -123,8 +123,8 @@ void Internal::search_assign_driving (int lit, Clause * c) {
 // This version of 'propagate' uses lazy watches and keeps two watched
 // literals at the beginning of the clause.  We also use 'blocking literals'
 // to reduce the number of times clauses have to be visited (2008 JSAT paper
-// by Chu, Harwood and Stuckey).  The watches know if a watched clause is
-// binary, in which case it never has to be visited.  If a binary clause is
+// by Chu, Harwood and Stuckey).  Binary clauses are watched in separate
+// watch lists and never have to be visited.  If a binary clause is
 // falsified we continue propagating.
 
 // Finally, for long clauses we save the position of the last watch
@@ -142,26 +142,31 @@ bool Internal::propagate () {
   // Updating statistics counter in the propagation loops is costly so we
   // delay until propagation ran to completion.
   //
-  int64_t before = propagated;
+  int64_t before = propagated2 = propagated;
 
-  while (!conflict && propagated != trail.size ()) {
+  // Look-ahead distance for prefetching clauses in long watch lists.
+  //
+  const int distance = opts.prefetch;
+
+  // Binary clauses are watched separately in 'binaries' and propagated
+  // first until completion (with 'propagated2' as second trail position,
+  // similar to 'probe_propagate').  Only then the next literal on the trail
+  // is propagated over the watches of long clauses in 'watches'.  This
+  // keeps the binary loop tight and avoids branching on binary watches.
 
-    const int lit = -trail[propagated++];
-    LOG ("propagating %d", -lit);
-    Watches & ws = watches (lit);
+  while (!conflict) {
 
-    const const_watch_iterator eow = ws.end ();
-    const_watch_iterator i = ws.begin ();
-    watch_iterator j = ws.begin ();
+    if (propagated2 != trail.size ()) {
 
-    while (i != eow) {
+      const int lit = -trail[propagated2++];
+      LOG ("propagating %d over binary clauses", -lit);
+      const Watches & ws = binaries (lit);
 
-      const Watch w = *j++ = *i++;
-      const int b = val (w.blit);
+      for (const auto & w : ws) {
 
-      if (b > 0) continue;                // blocking literal satisfied
+        const int b = val (w.blit);
 
-      if (w.binary ()) {
+        if (b > 0) continue;                // other literal satisfied
 
         // In principle we can ignore garbage binary clauses too, but that
         // would require to dereference the clause pointer all the time with
@@ -184,16 +189,55 @@ bool Internal::propagate () {
         // instances where this happens (which I found), and then
         // implemented the described fix.
 
-        // Binary clauses are treated separately since they do not require
-        // to access the clause at all (only during conflict analysis, and
-        // there also only to simplify the code).
+        // Binary clauses do not require to access the clause at all (only
+        // during conflict analysis, and there also only to simplify the
+        // code).
 
         if (b < 0) conflict = w.clause;          // but continue ...
         else search_assign (w.blit, w.clause);
+      }
 
-      } else {
+    } else if (propagated != trail.size ()) {
+
+      const int lit = -trail[propagated++];
+      LOG ("propagating %d over large clauses", -lit);
+      Watches & ws = watches (lit);
+
+      const const_watch_iterator eow = ws.end ();
+      const_watch_iterator i = ws.begin ();
+      watch_iterator j = ws.begin ();
+
+      // Dereferencing the clause below is a cache miss most of the time
+      // for large formulas.  With 'prefetch' enabled we let the cache line
+      // of the clause of a watch be loaded 'distance' watches before we
+      // actually need it.  The look-ahead 'p' stays ahead of 'i' and thus
+      // only reads watches not overwritten through 'j' yet, but it can not
+      // know whether the blocking literal will be satisfied when we reach
+      // that watch (then the prefetch is just wasted).
+
+      const_watch_iterator p = eow;
+
+      if (distance) {
+        p = ws.begin ();
+        const const_watch_iterator start =
+          (size_t) distance < ws.size () ? p + distance : eow;
+        while (p != start) {
+          if (val (p->blit) <= 0) prefetch (p->clause);
+          p++;
+        }
+      }
+
+      while (i != eow) {
 
-        if (conflict) break; // Stop if there was a binary conflict already.
+        if (p != eow) {
+          if (val (p->blit) <= 0) prefetch (p->clause);
+          p++;
+        }
+
+        const Watch w = *j++ = *i++;
+        const int b = val (w.blit);
+
+        if (b > 0) continue;                // blocking literal satisfied
 
         // The cache line with the clause data is forced to be loaded here
         // and thus this first memory access below is the real hot-spot of
@@ -330,15 +374,16 @@ bool Internal::propagate () {
           }
         }
       }
-    }
 
-    if (j != i) {
+      if (j != i) {
 
-      while (i != eow)
-        *j++ = *i++;
+        while (i != eow)
+          *j++ = *i++;
 
-      ws.resize (j - ws.begin ());
-    }
+        ws.resize (j - ws.begin ());
+      }
+
+    } else break;
   }
 
   if (searching_lucky_phases) {
@@ -350,7 +395,7 @@ bool Internal::propagate () {
 
     // Avoid updating stats eagerly in the hot-spot of the solver.
     //
-    stats.propagations.search += propagated - before;
+    stats.propagations.search += propagated2 - before;
 
     if (!conflict) no_conflict_until = propagated;
     else {
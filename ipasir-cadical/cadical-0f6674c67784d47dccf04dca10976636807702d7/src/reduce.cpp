@@ -33,18 +33,20 @@ bool Internal::flushing () {
 
 void Internal::protect_reasons () {
   for (const auto & lit : trail) {
-    Var & v = var (lit);
-    if (!v.level || !v.reason) continue;
-    LOG (v.reason, "protecting");
-    v.reason->reason = true;
+    if (!var (lit).level) continue;
+    Clause * c = reason (lit).clause;
+    if (!c) continue;
+    LOG (c, "protecting");
+    c->reason = true;
   }
 }
 
 void Internal::unprotect_reasons () {
   for (const auto & lit : trail) {
-    Var & v = var (lit);
-    if (!v.level || !v.reason) continue;
-    assert (v.reason->reason), v.reason->reason = false;
+    if (!var (lit).level) continue;
+    Clause * c = reason (lit).clause;
+    if (!c) continue;
+    assert (c->reason), c->reason = false;
   }
 }
 
@@ -0,0 +1,98 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Shrinking the core of failed assumptions after an unsatisfiable call to
+// 'solve' ('opts.shrinkcore' or 'Solver::shrink_core').  The core computed
+// by 'Internal::failing' contains all assumptions in the implication graph
+// of the final conflict and is often much larger than necessary.
+//
+// We go through the core and try to drop one assumption at a time by
+// solving under the remaining ones with at most 'opts.shrinkcorelim'
+// conflicts (iterative deletion).  If this is still unsatisfiable the core
+// is replaced by the failed assumptions of this call, which usually drops
+// many more assumptions at once (clause set refinement).  Otherwise, or if
+// the conflict limit is hit, the assumption is kept.  An assumption kept
+// because of a satisfiable call is in every core contained in the current
+// one and thus is never dropped by later refinements.
+//
+// If terminated (through 'terminate' or the terminator) we stop and keep
+// the core shrunken so far.  At the end the original assumptions are
+// assumed again and only those in the shrunken core are marked as failed,
+// such that 'failed' and 'failed_core' give the smaller core without any
+// further solving.
+
+void External::shrink_core () {
+
+  if (internal->unsat) return;
+
+  const vector<int> assumed = assumptions;
+
+  vector<int> core;
+  for (const auto & elit : assumed) {
+    if (!failed (elit)) continue;
+    if (find (core.begin (), core.end (), elit) != core.end ()) continue;
+    core.push_back (elit);
+  }
+
+  const size_t before = core.size ();
+  if (before <= 1) return;
+
+  START (shrink);
+  int64_t calls = 0;
+  size_t i = 0;
+
+  while (i < core.size () && !internal->unsat) {
+
+    if (internal->termination_forced.load (memory_order_relaxed)) break;
+
+    reset_assumptions ();
+    for (size_t j = 0; j < core.size (); j++)
+      if (j != i) assume (core[j]);
+    assume_contexts ();
+
+    internal->reset_limits ();
+    internal->limit ("conflicts", internal->opts.shrinkcorelim);
+    const int res = internal->solve ();
+    calls++;
+
+    // A forced termination is reset at the end of 'solve' and thus only
+    // recognized here by not having reached the conflict limit.
+    //
+    if (!res && internal->stats.conflicts < internal->lim.conflicts) {
+      LOG ("shrinking core interrupted");
+      break;
+    }
+
+    if (res == 20) {
+      size_t k = 0, kept = 0;
+      for (size_t j = 0; j < core.size (); j++) {
+        if (j == i || !failed (core[j])) continue;
+        if (j < i) kept++;
+        core[k++] = core[j];
+      }
+      core.resize (k);
+      i = kept;
+    } else i++;
+  }
+
+  reset_assumptions ();
+  for (const auto & elit : assumed)
+    assume (elit);
+  assume_contexts ();
+
+  if (internal->unsat) core.clear ();
+  for (const auto & elit : core) {
+    const int ilit = internalize (elit);
+    internal->flags (ilit).failed |= bign (ilit);
+  }
+
+  STOP (shrink);
+
+  VERBOSE (2, "shrunk core of %zd to %zd assumptions in %" PRId64 " calls",
+    before, core.size (), calls);
+}
+
+}
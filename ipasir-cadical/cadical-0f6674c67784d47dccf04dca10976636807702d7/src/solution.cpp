@@ -10,10 +10,14 @@ namespace CaDiCaL {
 // clause will raise an abort signal and thus allows to debug the issue with
 // a symbolic debugger immediately.
 
+// Clauses with internal only activation literals of contexts are not
+// checked, since the solution does not have to satisfy their clauses.
+
 void External::check_solution_on_learned_clause () {
   assert (solution);
   for (const auto & lit : internal->clause)
-    if (sol (internal->externalize (lit)) > 0)
+    if (internal->internal_only (lit) ||
+        sol (internal->externalize (lit)) > 0)
       return;
   internal->fatal_message_start ();
   fputs ("learned clause unsatisfied by solution:\n", stderr);
@@ -26,7 +30,8 @@ void External::check_solution_on_learned_clause () {
 void External::check_solution_on_shrunken_clause (Clause * c) {
   assert (solution);
   for (const auto & lit : *c)
-    if (sol (internal->externalize (lit)) > 0)
+    if (internal->internal_only (lit) ||
+        sol (internal->externalize (lit)) > 0)
       return;
   internal->fatal_message_start ();
   for (const auto & lit : *c)
@@ -42,6 +47,7 @@ void External::check_no_solution_after_learning_empty_clause () {
 
 void External::check_solution_on_learned_unit_clause (int unit) {
   assert (solution);
+  if (internal->internal_only (unit)) return;
   if (sol (internal->externalize (unit)) > 0) return;
   FATAL ("learned unit %d contradicts solution", unit);
 }
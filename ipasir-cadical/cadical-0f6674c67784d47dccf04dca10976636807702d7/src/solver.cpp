@@ -1,5 +1,13 @@
 #include "internal.hpp"
 
+// Threads are only used for cube-and-conquer in 'Solver::conquer'.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 /*------------------------------------------------------------------------*/
 
 namespace CaDiCaL {
@@ -386,6 +394,37 @@ void Solver::reserve (int min_max_var) {
   LOG_API_CALL_END ("reserve", min_max_var);
 }
 
+// API traces of resetting solvers are written as deleting the solver
+// and creating a new one, followed by setting all kept options which
+// differ from their default value.
+
+void Solver::reset (bool keep_options) {
+  REQUIRE_VALID_STATE ();
+  LOG_API_CALL_BEGIN ("reset", keep_options);
+  if (trace_api_file) {
+    trace_api_call ("reset");
+    trace_api_call ("init");
+  }
+  Internal * old_internal = internal;
+  External * old_external = external;
+  internal = new Internal ();
+  external = new External (internal);
+  if (keep_options) {
+    old_internal->opts.copy (internal->opts);
+    internal->prefix = old_internal->prefix;
+    if (trace_api_file)
+      for (Option * o = Options::begin (); o != Options::end (); o++) {
+        const int val = o->val (&internal->opts);
+        if (val != o->def) trace_api_call ("set", o->name, val);
+      }
+  }
+  internal->reuse (*old_internal);
+  delete old_internal;
+  delete old_external;
+  STATE (CONFIGURING);
+  LOG_API_CALL_END ("reset", keep_options);
+}
+
 /*------------------------------------------------------------------------*/
 
 void Solver::trace_api_calls (FILE * file) {
@@ -503,6 +542,30 @@ void Solver::add (int lit) {
   LOG_API_CALL_END ("add", lit);
 }
 
+void Solver::add_clauses (const int * lits, int size) {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (size >= 0, "negative number of literals '%d'", size);
+  REQUIRE (lits || !size, "zero literal buffer");
+  if (trace_api_file) {
+    // Keep the trace in the literal by literal format 'mobical' reads.
+    for (int i = 0; i < size; i++) add (lits[i]);
+    return;
+  }
+  LOG_API_CALL_BEGIN ("add_clauses");
+  if (size) {
+    transition_to_unknown_state ();
+    const int * end = lits + size;
+    for (const int * p = lits; p != end; p++) {
+      const int lit = *p;
+      REQUIRE (lit != INT_MIN, "invalid literal '%d'", lit);
+      external->add (lit);
+    }
+    if (end[-1]) STATE (ADDING);
+    else         STATE (UNKNOWN);
+  }
+  LOG_API_CALL_END ("add_clauses");
+}
+
 void Solver::assume (int lit) {
   TRACE ("assume", lit);
   REQUIRE_VALID_STATE ();
@@ -512,6 +575,27 @@ void Solver::assume (int lit) {
   LOG_API_CALL_END ("assume", lit);
 }
 
+void Solver::push () {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () != ADDING,
+    "clause incomplete (terminating zero not added)");
+  LOG_API_CALL_BEGIN ("push");
+  transition_to_unknown_state ();
+  external->push ();
+  LOG_API_CALL_END ("push");
+}
+
+void Solver::pop () {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () != ADDING,
+    "clause incomplete (terminating zero not added)");
+  REQUIRE (!external->contexts.empty (), "no context to pop");
+  LOG_API_CALL_BEGIN ("pop");
+  transition_to_unknown_state ();
+  external->pop ();
+  LOG_API_CALL_END ("pop");
+}
+
 /*------------------------------------------------------------------------*/
 
 int Solver::call_external_solve_and_check_results () {
@@ -545,11 +629,150 @@ int Solver::call_external_solve_and_check_results () {
   return res;
 }
 
+/*------------------------------------------------------------------------*/
+
+// Cube-and-conquer ('opts.cube') splits the formula under the current
+// assumptions into cubes by lookahead (see 'cube.cpp') and solves them on
+// 'opts.cubethreads' threads, each working on its own copy of this solver.
+// For refuted cubes the negation of their failed literals (including failed
+// assumptions) is imported as redundant clause.  For a satisfiable cube its
+// literals are assumed too and the model of the copy is used as saved
+// phases.  In both cases the actual result (as well as models and failed
+// assumptions) is determined by the standard search of this solver
+// afterwards, which is then supposed to be cheap.  The copies are stopped
+// as soon one finds a model or this solver is asked to terminate.
+// Since the imported clauses are derived by the copies they can not be
+// checked, thus 'solve' skips cube-and-conquer if a proof is connected.
+
+struct CubeTerminator : Terminator {
+  const std::atomic<bool> & stop;
+  CubeTerminator (const std::atomic<bool> & s) : stop (s) { }
+  bool terminate () { return stop; }
+};
+
+void Solver::conquer () {
+
+  // The copies get the clauses of open contexts as ordinary clauses (see
+  // 'traverse_clauses') and the clauses derived from refuted cubes are
+  // imported into the innermost context (see 'import_clauses').
+  //
+  external->assume_contexts ();
+  const vector<int> & assumptions = external->assumptions;
+
+  vector<vector<int>> cubes;
+  internal->generate_cubes (internal->opts.cubedepth, cubes);
+  if (cubes.size () < 2) return;
+
+  size_t threads = internal->opts.cubethreads;
+  if (!threads) threads = std::thread::hardware_concurrency ();
+  if (!threads) threads = 1;
+  if (threads > cubes.size ()) threads = cubes.size ();
+
+  VERBOSE (1, "conquering %zd cubes on %zd threads",
+    cubes.size (), threads);
+
+  const int max_var = external->max_var;
+
+  vector<Solver *> copies;
+  for (size_t i = 0; i < threads; i++) {
+    Solver * other = new Solver ();
+    other->set ("seed", (int) i);
+    other->set ("sparse", internal->opts.sparse);
+    copy (*other);
+    other->reserve (max_var);
+    copies.push_back (other);
+  }
+
+  std::atomic<bool> stop (false);
+  std::atomic<size_t> next (0);
+  std::mutex results;
+  std::condition_variable finishing;
+  size_t finished = 0;
+
+  vector<int> refuted;          // Negated failed literals of refuted cubes.
+  vector<int> model;            // Model of first satisfiable cube.
+  const vector<int> * satisfied = 0;
+
+  auto work = [&] (Solver * other) {
+    CubeTerminator terminator (stop);
+    other->connect_terminator (&terminator);
+    size_t i;
+    while (!stop && (i = next++) < cubes.size ()) {
+      const vector<int> & cube = cubes[i];
+      for (const auto & lit : assumptions) other->assume (lit);
+      for (const auto & lit : cube) other->assume (lit);
+      const int res = other->solve ();
+      std::lock_guard<std::mutex> guard (results);
+      if (res == 10) {
+        if (!satisfied) {
+          for (int idx = 1; idx <= max_var; idx = external->e2i.next (idx))
+            if (external->e2i[idx]) model.push_back (other->val (idx));
+          satisfied = &cube;
+        }
+        stop = true;
+      } else if (res == 20) {
+        for (const auto & lit : assumptions)
+          if (other->failed (lit)) refuted.push_back (-lit);
+        for (const auto & lit : cube)
+          if (other->failed (lit)) refuted.push_back (-lit);
+        refuted.push_back (0);
+      }
+    }
+    other->disconnect_terminator ();
+    std::lock_guard<std::mutex> guard (results);
+    finished++;
+    finishing.notify_one ();
+  };
+
+  vector<std::thread> workers;
+  for (const auto & other : copies)
+    workers.push_back (std::thread (work, other));
+
+  // Only this thread calls the terminator of this solver.
+  //
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock (results);
+      if (finished == threads) break;
+      finishing.wait_for (lock, std::chrono::milliseconds (10));
+      if (finished == threads) break;
+    }
+    if (internal->termination_forced ||
+        (external->terminator && external->terminator->terminate ()))
+      stop = true;
+  }
+
+  for (auto & worker : workers)
+    worker.join ();
+  for (const auto & other : copies)
+    delete other;
+
+  if (!internal->unsat)
+    internal->import_clauses (refuted.data (), refuted.size ());
+
+  if (satisfied) {
+    for (const auto & lit : model) {
+      const int ilit = external->e2i[abs (lit)];
+      if (!ilit) continue;
+      const int tmp = (lit > 0) == (ilit > 0) ? 1 : -1;
+      internal->phases.saved[abs (ilit)] = tmp;
+    }
+    for (const auto & lit : *satisfied)
+      external->assume (lit);
+  }
+}
+
 int Solver::solve () {
   TRACE ("solve");
   REQUIRE_VALID_STATE ();
   REQUIRE (state () != ADDING,
     "clause incomplete (terminating zero not added)");
+  if (internal->opts.cube) {
+    transition_to_unknown_state ();
+    if (internal->proof)
+      VERBOSE (1, "no cube-and-conquer while tracing or checking proofs");
+    else conquer ();
+  }
   int res = call_external_solve_and_check_results ();
   LOG_API_CALL_RETURNS ("solve", res);
   return res;
@@ -582,6 +805,39 @@ int Solver::val (int lit) {
   return res;
 }
 
+void Solver::val_range (int first, int last, int * values) {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () == SATISFIED,
+    "can only get values in satisfied state");
+  REQUIRE (first > 0, "invalid first variable '%d'", first);
+  REQUIRE (first - 1 <= last, "invalid last variable '%d'", last);
+  REQUIRE (values || first > last, "zero value buffer");
+  if (trace_api_file) {
+    for (int idx = first; idx <= last; idx++) *values++ = val (idx);
+    return;
+  }
+  LOG_API_CALL_BEGIN ("val_range", first);
+  external->val_range (first, last, values);
+  LOG_API_CALL_END ("val_range", first);
+}
+
+void Solver::val_range (int first, int last, signed char * values) {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () == SATISFIED,
+    "can only get values in satisfied state");
+  REQUIRE (first > 0, "invalid first variable '%d'", first);
+  REQUIRE (first - 1 <= last, "invalid last variable '%d'", last);
+  REQUIRE (values || first > last, "zero value buffer");
+  if (trace_api_file) {
+    for (int idx = first; idx <= last; idx++)
+      *values++ = val (idx) < 0 ? -1 : 1;
+    return;
+  }
+  LOG_API_CALL_BEGIN ("val_range", first);
+  external->val_range (first, last, values);
+  LOG_API_CALL_END ("val_range", first);
+}
+
 bool Solver::failed (int lit) {
   TRACE ("failed", lit);
   REQUIRE_VALID_STATE ();
@@ -593,6 +849,120 @@ bool Solver::failed (int lit) {
   return res;
 }
 
+int Solver::failed_core (int * core, int size) {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () == UNSATISFIED,
+    "can only get failed assumptions in unsatisfied state");
+  REQUIRE (size >= 0, "negative core size '%d'", size);
+  REQUIRE (core || !size, "zero core buffer");
+  if (trace_api_file) {
+    vector<bool> reported;
+    int res = 0;
+    for (const auto & lit : external->assumptions)
+      if (!external->marked (reported, lit) && failed (lit)) {
+        external->mark (reported, lit);
+        if (res < size) core[res] = lit;
+        res++;
+      }
+    return res;
+  }
+  LOG_API_CALL_BEGIN ("failed_core", size);
+  int res = external->failed_core (core, size);
+  LOG_API_CALL_RETURNS ("failed_core", size, res);
+  return res;
+}
+
+int Solver::shrink_core () {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () == UNSATISFIED,
+    "can only shrink failed assumptions in unsatisfied state");
+  LOG_API_CALL_BEGIN ("shrink_core");
+  external->shrink_core ();
+  int res = external->failed_core (0, 0);
+  LOG_API_CALL_RETURNS ("shrink_core", res);
+  return res;
+}
+
+int Solver::propagate (const int * assumptions, int size,
+                       int * implied, int capacity) {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () != ADDING,
+    "clause incomplete (terminating zero not added)");
+  REQUIRE (size >= 0, "negative number of assumptions '%d'", size);
+  REQUIRE (assumptions || !size, "zero assumption buffer");
+  REQUIRE (capacity >= 0, "negative implied capacity '%d'", capacity);
+  REQUIRE (implied || !capacity, "zero implied buffer");
+  for (int i = 0; i < size; i++)
+    REQUIRE_VALID_LIT (assumptions[i]);
+  LOG_API_CALL_BEGIN ("propagate", size);
+  transition_to_unknown_state ();
+  for (int i = 0; i < size; i++)
+    external->assume (assumptions[i]);
+  int res = external->propagate (implied, capacity);
+  external->reset_assumptions ();
+  LOG_API_CALL_RETURNS ("propagate", size, res);
+  return res;
+}
+
+int Solver::backbone (std::vector<int> & backbone) {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () != ADDING,
+    "clause incomplete (terminating zero not added)");
+  LOG_API_CALL_BEGIN ("backbone");
+  transition_to_unknown_state ();
+  STATE (SOLVING);
+  int res = external->backbone (backbone);
+  if (res == 20) STATE (UNSATISFIED);
+  else           STATE (UNKNOWN);
+  LOG_API_CALL_RETURNS ("backbone", res);
+  return res;
+}
+
+int Solver::enumerate (Enumerator & enumerator,
+                       const std::vector<int> & projection, int64_t limit) {
+  REQUIRE_VALID_STATE ();
+  REQUIRE (state () != ADDING,
+    "clause incomplete (terminating zero not added)");
+  for (const auto & idx : projection)
+    REQUIRE_VALID_LIT (idx);
+  LOG_API_CALL_BEGIN ("enumerate");
+  transition_to_unknown_state ();
+  STATE (SOLVING);
+  int res = external->enumerate (enumerator, projection, limit);
+  STATE (UNKNOWN);
+  LOG_API_CALL_RETURNS ("enumerate", res);
+  return res;
+}
+
+void Solver::connect_importer (Importer * importer) {
+  LOG_API_CALL_BEGIN ("connect_importer");
+  REQUIRE_VALID_STATE ();
+  REQUIRE (importer, "can not connect zero importer");
+  REQUIRE (!internal->proof,
+    "can not import clauses while tracing or checking proofs");
+#ifdef LOGGING
+  if (external->importer)
+    LOG ("connecting new importer (disconnecting previous one)");
+  else
+    LOG ("connecting new importer (no previous one)");
+#endif
+  external->importer = importer;
+  LOG_API_CALL_END ("connect_importer");
+}
+
+void Solver::disconnect_importer () {
+  LOG_API_CALL_BEGIN ("disconnect_importer");
+  REQUIRE_VALID_STATE ();
+#ifdef LOGGING
+    if (external->importer)
+      LOG ("disconnecting previous importer");
+    else
+      LOG ("ignoring to disconnect importer (no previous one)");
+#endif
+  external->importer = 0;
+  LOG_API_CALL_END ("disconnect_importer");
+}
+
 int Solver::fixed (int lit) const {
   TRACE ("fixed", lit);
   REQUIRE_VALID_STATE ();
@@ -638,6 +1008,33 @@ void Solver::disconnect_terminator () {
   LOG_API_CALL_END ("disconnect_terminator");
 }
 
+void Solver::connect_learner (Learner * learner) {
+  LOG_API_CALL_BEGIN ("connect_learner");
+  REQUIRE_VALID_STATE ();
+  REQUIRE (learner, "can not connect zero learner");
+#ifdef LOGGING
+  if (external->learner)
+    LOG ("connecting new learner (disconnecting previous one)");
+  else
+    LOG ("connecting new learner (no previous one)");
+#endif
+  external->learner = learner;
+  LOG_API_CALL_END ("connect_learner");
+}
+
+void Solver::disconnect_learner () {
+  LOG_API_CALL_BEGIN ("disconnect_learner");
+  REQUIRE_VALID_STATE ();
+#ifdef LOGGING
+    if (external->learner)
+      LOG ("disconnecting previous learner");
+    else
+      LOG ("ignoring to disconnect learner (no previous one)");
+#endif
+  external->learner = 0;
+  LOG_API_CALL_END ("disconnect_learner");
+}
+
 /*===== IPASIR END =======================================================*/
 
 int Solver::active () const {
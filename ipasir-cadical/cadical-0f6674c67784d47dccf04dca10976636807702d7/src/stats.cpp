@@ -118,6 +118,8 @@ void Stats::print (Internal * internal) {
   PRT ("  hyper:         %15" PRId64 "   %10.2f %%  per conflict", stats.flush.hyper, relative (stats.flush.hyper, stats.conflicts));
   PRT ("  flushings:     %15" PRId64 "   %10.2f    interval", stats.flush.count, relative (stats.conflicts, stats.flush.count));
   }
+  if (all || stats.imported)
+  PRT ("imported:        %15" PRId64 "   %10.2f    interval", stats.imported, relative (stats.conflicts, stats.imported));
   if (all || stats.instantiated) {
   PRT ("instantiated:    %15" PRId64 "   %10.2f %%  of tried", stats.instantiated, percent (stats.instantiated, stats.instried));
   PRT ("x instrounds:    %15" PRId64 "   %10.2f %%  of elimrounds", stats.instrounds, percent (stats.instrounds, stats.elimrounds));
@@ -140,6 +142,8 @@ void Stats::print (Internal * internal) {
   PRT ("  extendbytes:   %15" PRId64 "   %10.2f    bytes and MB", extendbytes, extendbytes/(double)(1l<<20));
   if (all || stats.learned.clauses)
   PRT ("minimized:       %15" PRId64 "   %10.2f %%  learned literals", stats.minimized, percent (stats.minimized, stats.learned.literals));
+  if (all || stats.pushed)
+  PRT ("popped:          %15" PRId64 "   %10.2f %%  of pushed", stats.popped, percent (stats.popped, stats.pushed));
   PRT ("propagations:    %15" PRId64 "   %10.2f M  per second", propagations, relative (propagations/1e6, t));
   PRT ("  coverprops:    %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.cover, percent (stats.propagations.cover, propagations));
   PRT ("  probeprops:    %15" PRId64 "   %10.2f %%  of propagations", stats.propagations.probe, percent (stats.propagations.probe, propagations));
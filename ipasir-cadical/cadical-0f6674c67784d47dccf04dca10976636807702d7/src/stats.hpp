@@ -163,6 +163,7 @@ struct Stats {
   int64_t garbage;      // bytes current irredundant garbage clauses
   int64_t units;        // learned unit clauses
   int64_t binaries;     // learned binary clauses
+  int64_t imported;     // imported clauses
   int64_t probingphases;// number of scheduled probing phases
   int64_t probingrounds;// number of probing rounds
   int64_t probed;       // number of probed literals
@@ -184,6 +185,8 @@ struct Stats {
   int64_t restored;     // number of restored clauses
   int64_t reactivated;  // number of reactivated clauses
   int64_t restoredlits; // number of restored literals
+  int64_t pushed;       // number of pushed contexts
+  int64_t popped;       // number of popped contexts
 
   int64_t preprocessings;
 
@@ -0,0 +1,307 @@
+#include "cadical.hpp"
+#include "tiny.hpp"
+
+#include <cassert>
+#include <climits>
+#include <cstring>
+
+namespace CaDiCaL {
+
+Tiny::Tiny (int v, int c, int64_t e) :
+  vars (v < max_vars ? v : max_vars), size (c), effort (e),
+  max_var (0), inconsistent (false), result (0), terminated (false),
+  interrupted (0), terminator (0), conflicts (0)
+{
+  memset (pos, 0, sizeof pos);
+  memset (neg, 0, sizeof neg);
+  memset (bumped, 0, sizeof bumped);
+  memset (phase, 1, sizeof phase);
+}
+
+bool Tiny::fits (int lit) const {
+  return lit && lit != INT_MIN && abs (lit) <= vars;
+}
+
+// Bit of variable 'idx' in word 'word (idx)' of a bit-set.
+
+static int word (int idx) { return (idx - 1) / 64; }
+static uint64_t mask (int idx) { return (uint64_t) 1 << ((idx - 1) % 64); }
+
+/*------------------------------------------------------------------------*/
+
+// Literals which do not fit are not consumed, such that the caller can
+// pass them on to the full solver after replaying 'literals'.  Duplicated
+// literals and tautological clauses are detected with the bit-sets 'pos'
+// and 'neg' of the currently added clause.
+
+bool Tiny::add (int lit) {
+  result = 0;
+  if (lit) {
+    if (!fits (lit)) return false;
+    const int idx = abs (lit);
+    uint64_t & bits = (lit > 0 ? pos : neg)[word (idx)];
+    if (!(bits & mask (idx))) bits |= mask (idx), lits.push_back (lit);
+    if (idx > max_var) max_var = idx;
+  } else {
+    if (clauses.size () >= size) return false;
+    const int first = clauses.empty () ? 0
+                    : clauses.back ().start + clauses.back ().size;
+    const int last = lits.size ();
+    bool tautological = false;
+    for (int i = first; i < last; i++) {
+      const int idx = abs (lits[i]);
+      if (pos[word (idx)] & neg[word (idx)] & mask (idx))
+        tautological = true;
+      pos[word (idx)] &= ~mask (idx);
+      neg[word (idx)] &= ~mask (idx);
+    }
+    if (first == last) inconsistent = true;
+    else if (tautological) lits.resize (first);
+    else clauses.push_back ({ first, last - first, 0, 0 });
+  }
+  literals.push_back (lit);
+  return true;
+}
+
+// Assumed variables are searched (and get a value in the model) even if
+// they do not occur in any clause, thus they count for 'max_var' too.
+
+bool Tiny::assume (int lit) {
+  if (!fits (lit)) return false;
+  result = 0;
+  assumptions.push_back (lit);
+  const int idx = abs (lit);
+  if (idx > max_var) max_var = idx;
+  return true;
+}
+
+int Tiny::val (int lit) const {
+  assert (result == 10);
+  const int idx = abs (lit);
+  if (idx > max_var) return -idx;
+  const bool positive = model[word (idx)] & mask (idx);
+  return (positive == (lit > 0)) ? idx : -idx;
+}
+
+/*------------------------------------------------------------------------*/
+
+// Lays out the occurrence lists of all clauses leaving as much space for
+// learned clauses as already used (plus a few), which is repeated as soon
+// one occurrence list overflows.  This needs a single allocation.
+
+void Tiny::connect () {
+  const int n = 2 * max_var + 2;
+  memset (occurring, 0, n * sizeof *occurring);
+  for (const auto & lit : lits) occurring[index (lit)]++;
+  int total = 0;
+  for (int i = 0; i < n; i++) {
+    start[i] = total;
+    total += 2 * occurring[i] + 4;
+    occurring[i] = 0;
+  }
+  start[n] = total;
+  occs.resize (total);
+  for (size_t ref = 0; ref < clauses.size (); ref++) {
+    const Clause & c = clauses[ref];
+    for (int k = c.start; k < c.start + c.size; k++) {
+      const int i = index (lits[k]);
+      occs[start[i] + occurring[i]++] = ref;
+    }
+  }
+}
+
+int Tiny::value (int lit) const {
+  const int idx = abs (lit);
+  if (T[word (idx)] & mask (idx)) return lit > 0 ? 1 : -1;
+  if (F[word (idx)] & mask (idx)) return lit < 0 ? 1 : -1;
+  return 0;
+}
+
+void Tiny::assign (int lit, int r) {
+  const int idx = abs (lit);
+  (lit > 0 ? T : F)[word (idx)] |= mask (idx);
+  level[idx] = decisions;
+  reason[idx] = r;
+  trail[assigned++] = lit;
+}
+
+// Only propagated literals were counted in 'satisfied' and 'falsified'.
+
+void Tiny::backtrack (int new_level) {
+  assert (new_level < decisions);
+  const int height = control[new_level];
+  while (assigned > height) {
+    const int lit = trail[--assigned];
+    const int idx = abs (lit);
+    if (assigned < propagated) {
+      for (const int * p = begin (lit); p != end (lit); p++)
+        clauses[*p].satisfied--;
+      for (const int * p = begin (-lit); p != end (-lit); p++)
+        clauses[*p].falsified--;
+    }
+    T[word (idx)] &= ~mask (idx);
+    F[word (idx)] &= ~mask (idx);
+    phase[idx] = lit > 0;
+  }
+  if (propagated > assigned) propagated = assigned;
+  decisions = new_level;
+}
+
+// Clauses with at most one literal not yet propagated as false are checked
+// on the assignment, since literals on the trail which are not propagated
+// yet are not counted.  Counting continues after a conflict, such that
+// 'backtrack' can undo all counts of propagated literals.  Returns the
+// conflicting clause or '-1'.
+
+int Tiny::propagate () {
+  int conflict = -1;
+  while (conflict < 0 && propagated < assigned) {
+    const int lit = trail[propagated++];
+    ticks -= occurring[index (lit)] + occurring[index (-lit)];
+    for (const int * p = begin (lit); p != end (lit); p++)
+      clauses[*p].satisfied++;
+    for (const int * p = begin (-lit); p != end (-lit); p++) {
+      Clause & c = clauses[*p];
+      if (++c.falsified < c.size - 1 || c.satisfied || conflict >= 0)
+        continue;
+      int unassigned = 0, unit = 0, tmp = 0;
+      for (int k = c.start; k < c.start + c.size; k++) {
+        const int other = lits[k];
+        if ((tmp = value (other)) > 0) break;
+        if (!tmp) unassigned++, unit = other;
+      }
+      if (tmp > 0) continue;
+      if (!unassigned) conflict = *p;
+      else if (unassigned == 1) assign (unit, *p);
+    }
+  }
+  return conflict;
+}
+
+// Resolves the conflicting clause with reasons of the trail in reverse
+// order until a single literal of the current decision level is left,
+// then learns the resulting clause, backjumps and assigns that literal.
+// The learned clause is collected at the end of 'lits'.  Fails if there
+// are too many learned clauses.
+
+bool Tiny::analyze (int conflict) {
+  if (clauses.size () >= 2 * size) return false;
+  uint64_t seen[words] = { 0 };
+  const int learned = lits.size ();
+  int height = assigned, open = 0, jump = 0, ref = conflict, uip;
+  conflicts++;
+  for (;;) {
+    const Clause & c = clauses[ref];
+    ticks -= c.size;
+    for (int k = c.start; k < c.start + c.size; k++) {
+      const int lit = lits[k], idx = abs (lit);
+      if (!level[idx] || (seen[word (idx)] & mask (idx))) continue;
+      seen[word (idx)] |= mask (idx);
+      bumped[idx] = conflicts;
+      if (level[idx] == decisions) { open++; continue; }
+      lits.push_back (lit);
+      if (level[idx] > jump) jump = level[idx];
+    }
+    int lit;
+    do lit = trail[--height];
+    while (!(seen[word (abs (lit))] & mask (abs (lit))));
+    if (!--open) { uip = -lit; break; }
+    ref = reason[abs (lit)];
+    assert (ref >= 0);
+  }
+  lits.push_back (uip);
+  const int length = lits.size () - learned;
+  ref = clauses.size ();
+  clauses.push_back ({ learned, length, 0, length - 1 });
+  bool full = false;
+  for (int k = learned; k < learned + length; k++) {
+    const int i = index (lits[k]);
+    if (start[i] + occurring[i] == start[i + 1]) full = true;
+  }
+  if (full) connect ();
+  else
+    for (int k = learned; k < learned + length; k++) {
+      const int i = index (lits[k]);
+      occs[start[i] + occurring[i]++] = ref;
+    }
+  backtrack (jump);
+  assign (uip, ref);
+  return true;
+}
+
+// Returns the next decision, zero if all variables are assigned and
+// 'INT_MIN' if an assumption is falsified.
+
+int Tiny::decide () {
+  for (const auto & lit : assumptions) {
+    const int tmp = value (lit);
+    if (tmp > 0) continue;
+    return tmp < 0 ? INT_MIN : lit;
+  }
+  int res = 0;
+  for (int idx = 1; idx <= max_var; idx++)
+    if (!value (idx) && (!res || bumped[idx] > bumped[res])) res = idx;
+  return res && !phase[res] ? -res : res;
+}
+
+bool Tiny::terminating () {
+  if (interrupted && interrupted->load (std::memory_order_relaxed))
+    terminated = true;
+  else if (terminator && terminator->terminate ())
+    terminated = true;
+  return terminated;
+}
+
+int Tiny::search () {
+  memset (T, 0, sizeof T);
+  memset (F, 0, sizeof F);
+  assigned = propagated = decisions = 0;
+  connect ();
+  for (size_t ref = 0; ref < clauses.size (); ref++) {
+    Clause & c = clauses[ref];
+    c.satisfied = c.falsified = 0;
+    if (c.size > 1) continue;
+    const int unit = lits[c.start], tmp = value (unit);
+    if (tmp < 0) return 20;
+    if (!tmp) assign (unit, ref);
+  }
+  ticks = effort;
+  if (terminating ()) return 0;
+  for (;;) {
+    const int conflict = propagate ();
+    if (ticks < 0) return 0;
+    if (conflict >= 0) {
+      if (!decisions) return 20;
+      if (terminating ()) return 0;
+      if (!analyze (conflict)) return 0;
+    } else {
+      const int lit = decide ();
+      if (!lit) return 10;
+      if (lit == INT_MIN) return 0;
+      control[decisions++] = assigned;
+      assign (lit, -1);
+    }
+  }
+}
+
+int Tiny::solve () {
+  result = 0;
+  terminated = false;
+  if (!literals.empty () && literals.back ()) return 0;
+  if (inconsistent) return assumptions.empty () ? (result = 20) : 0;
+  const size_t irredundant = clauses.size (), original = lits.size ();
+  const int res = search ();
+  clauses.resize (irredundant);
+  lits.resize (original);
+  if (res == 10) {
+    memcpy (model, T, sizeof model);
+    assumptions.clear ();
+    result = 10;
+  } else if (res == 20 && assumptions.empty ()) {
+    inconsistent = true;
+    result = 20;
+  }
+  return result;
+}
+
+}
@@ -0,0 +1,119 @@
+#ifndef _tiny_hpp_INCLUDED
+#define _tiny_hpp_INCLUDED
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace CaDiCaL {
+
+class Terminator;
+
+/*------------------------------------------------------------------------*/
+
+// Light-weight solver engine for tiny formulas used by the C wrapper in
+// 'ccadical.cpp' (and thus also by IPASIR) in front of the full solver.
+// For formulas with a few hundred variables and clauses allocating and
+// initializing the tables of 'Internal' and running 'lucky' phases and the
+// inprocessing schedule dominate the actual search.  This engine only uses
+// fixed-size variable arrays, bit-sets for the assignment and a few flat
+// vectors and runs a plain CDCL loop.  Propagation counts satisfied and
+// falsified literals of clauses through occurrence lists, conflict
+// analysis learns the first unique implication point clause and decisions
+// pick the most recently bumped variable with phase saving.  Learned
+// clauses are discarded after each 'solve' call, which also does not
+// restart nor reduce.
+//
+// As soon the formula does not fit anymore ('add' and 'assume' return
+// 'false') or 'solve' can not decide it within 'effort' occurrence visits,
+// the wrapper moves the formula to the full solver by replaying 'literals'
+// and 'assumptions' and never uses this engine again.  Unsatisfiability
+// under assumptions is also left to the full solver, since failed
+// assumptions are not determined here.
+//
+// Like the full solver 'solve' checks for termination before the search
+// and after each conflict, through the 'interrupted' flag and by polling
+// the 'terminator'.  It then returns zero and sets 'terminated'.
+
+struct Tiny {
+
+  static const int max_vars = 256;              // Bit-set size.
+  static const int words = max_vars / 64;
+
+  struct Clause {
+    int start, size;            // Literals 'lits[start..start+size-1]'.
+    int satisfied, falsified;   // Propagated literals.
+  };
+
+  const int vars;               // Accepted variable limit (opts.tinyvars).
+  const size_t size;            // Accepted clauses (opts.tinyclauses).
+  const int64_t effort;         // Occurrence visits per 'solve'.
+
+  int max_var;                  // Maximum variable added or assumed.
+  bool inconsistent;            // Empty clause added or derived.
+  int result;                   // Of last 'solve' (10, 20 or zero).
+  bool terminated;              // Last 'solve' stopped by termination.
+
+  const std::atomic<bool> * interrupted;        // Checked if non-zero.
+  Terminator * terminator;                      // Polled if non-zero.
+
+  std::vector<int> literals;    // All added literals for replaying.
+  std::vector<int> assumptions; // Assumptions for the next 'solve'.
+  std::vector<Clause> clauses;  // Irredundant clauses (then learned).
+  std::vector<int> lits;        // Literals of 'clauses'.
+  uint64_t pos[words], neg[words];      // Currently added clause.
+
+  // Search state where 'T' and 'F' are the variables assigned to true and
+  // false and all other arrays are indexed by variable, except for 'trail'
+  // and 'control', which saves the trail height before each decision.
+
+  uint64_t T[words], F[words], model[words];
+  int level[max_vars + 1], reason[max_vars + 1];
+  int64_t bumped[max_vars + 1];
+  bool phase[max_vars + 1];
+  int trail[max_vars], control[max_vars + 1];
+  int assigned, propagated, decisions;
+  int64_t ticks, conflicts;
+
+  // Occurrence lists are kept in 'occs' as consecutive slices starting at
+  // 'start' for each literal, with some space left for learned clauses.
+
+  std::vector<int> occs;
+  int start[2 * max_vars + 3], occurring[2 * max_vars + 2];
+
+  Tiny (int vars, int clauses, int64_t effort);
+
+  bool add (int lit);           // Returns 'false' if too many clauses.
+  bool assume (int lit);        // Returns 'false' if variable too large.
+  int solve ();                 // Returns zero if left to full solver.
+  int val (int lit) const;      // Requires 'result == 10'.
+
+  bool fits (int lit) const;    // Valid literal with variable in range.
+
+private:
+
+  static int index (int lit) { return 2 * abs (lit) + (lit < 0); }
+
+  const int * begin (int lit) const {
+    return occs.data () + start[index (lit)];
+  }
+  const int * end (int lit) const {
+    return begin (lit) + occurring[index (lit)];
+  }
+
+  void connect ();
+  int value (int lit) const;
+  void assign (int lit, int reason);
+  void backtrack (int new_level);
+  int propagate ();
+  bool analyze (int conflict);
+  int decide ();
+  bool terminating ();
+  int search ();
+};
+
+}
+
+#endif
@@ -72,6 +72,19 @@ inline void clear_n (T * base, size_t n) {
 
 /*------------------------------------------------------------------------*/
 
+// Hint to the processor to load the cache line of 'p' (for reading).  This
+// is a no-op for compilers which do not support '__builtin_prefetch'.
+
+inline void prefetch (const void * p) {
+#ifdef __GNUC__
+  __builtin_prefetch (p);
+#else
+  (void) p;
+#endif
+}
+
+/*------------------------------------------------------------------------*/
+
 // These are options both to 'cadical' and 'mobical'.  After wasting some
 // on not remembering the spelling (British vs American), nor singular vs
 // plural and then wanted to use '--color=false', and '--colours=0' too, I
@@ -52,9 +52,9 @@ inline void Internal::vivify_assign (int lit, Clause * reason) {
   assert (!vals[idx]);
   assert (!flags (idx).eliminated () || !reason);
   Var & v = var (idx);
-  v.level = level;                      // required to reuse decisions
-  v.trail = (int) trail.size ();        // used in 'vivify_better_watch'
-  v.reason = level ? reason : 0;        // for conflict analysis
+  v.level = level;                        // required to reuse decisions
+  v.trail = (int) trail.size ();          // used in 'vivify_better_watch'
+  rtab[idx].clause = level ? reason : 0;  // for conflict analysis
   if (!level) learn_unit_clause (lit);
   const signed_char tmp = sign (lit);
   vals[idx] = tmp;
@@ -90,9 +90,8 @@ bool Internal::vivify_propagate () {
     if (propagated2 != trail.size ()) {
       const int lit = -trail[propagated2++];
       LOG ("vivify propagating %d over binary clauses", -lit);
-      Watches & ws = watches (lit);
+      Watches & ws = binaries (lit);
       for (const auto & w : ws) {
-        if (!w.binary ()) continue;
         const int b = val (w.blit);
         if (b > 0) continue;
         if (b < 0) conflict = w.clause;                 // but continue
@@ -107,7 +106,6 @@ bool Internal::vivify_propagate () {
       watch_iterator j = ws.begin ();
       while (i != eow) {
         const Watch w = *j++ = *i++;
-        if (w.binary ()) continue;
         if (val (w.blit) > 0) continue;
         if (w.clause->garbage) { j--; continue; }
         if (w.clause == ignore) continue;
@@ -379,7 +377,8 @@ void Internal::vivify_analyze_redundant (Vivifier & vivifier,
       assert (val (lit) < 0);
       f.seen = true;
       analyzed.push_back (lit);
-      if (v.reason) stack.push_back (v.reason);
+      Clause * r = reason (lit).clause;
+      if (r) stack.push_back (r);
       else LOG ("vivify seen %d", lit);
     }
   }
@@ -396,9 +395,8 @@ bool Internal::vivify_all_decisions (Clause * c, int subsume) {
   for (const auto & other : *c) {
     if (other == subsume) continue;
     if (val (other) >= 0) return false;
-    Var & v = var (other);
-    if (!v.level) continue;
-    if (v.reason) return false;
+    if (!var (other).level) continue;
+    if (reason (other).clause) return false;
     if (!flags (other).seen) return false;
   }
 
@@ -430,14 +428,13 @@ void Internal::vivify_post_process_analysis (Clause * c, int subsume) {
 
       enum { FLUSH, IGNORE, KEEP } action;
 
-           if (other == subsume)     action = KEEP;
-      else if (val (other) >= 0)     action = FLUSH;
+           if (other == subsume)        action = KEEP;
+      else if (val (other) >= 0)        action = FLUSH;
       else {
-        Var & v = var (other);
-             if (!v.level)           action = IGNORE;
-        else if (v.reason)           action = FLUSH;
-        else if (flags (other).seen) action = KEEP;
-        else                         action = FLUSH;
+             if (!var (other).level)    action = IGNORE;
+        else if (reason (other).clause) action = FLUSH;
+        else if (flags (other).seen)    action = KEEP;
+        else                            action = FLUSH;
       }
 
       if (action == KEEP) clause.push_back (other);
@@ -613,7 +610,7 @@ void Internal::vivify_clause (Vivifier & vivifier, Clause * c) {
     for (const auto & lit : *c) {
       const int tmp = val (lit);
       if (tmp < 0) continue;
-      if (tmp > 0 && var (lit).reason == c) forced = lit;
+      if (tmp > 0 && reason (lit).clause == c) forced = lit;
       break;
     }
     if (forced) {
@@ -690,10 +687,9 @@ void Internal::vivify_clause (Vivifier & vivifier, Clause * c) {
 
     if (tmp) {                // literal already assigned
 
-      const Var & v = var (lit);
-
-      if (!v.level) { LOG ("skipping fixed %d", lit); continue; }
-      if (!v.reason) { LOG ("skipping decision %d", lit); continue; }
+      if (!var (lit).level) { LOG ("skipping fixed %d", lit); continue; }
+      Clause * implied = reason (lit).clause;
+      if (!implied) { LOG ("skipping decision %d", lit); continue; }
 
       if (tmp > 0) {          // positively implied
 
@@ -717,11 +713,11 @@ void Internal::vivify_clause (Vivifier & vivifier, Clause * c) {
           flags (lit).seen = true;
           analyzed.push_back (-lit);
           LOG ("vivify seen %d", -lit);
-          assert (v.reason);
+          assert (implied);
 
           // Continue the analysis with the reason of the implied literal.
           //
-          vivify_analyze_redundant (vivifier, v.reason, only_binary_reasons);
+          vivify_analyze_redundant (vivifier, implied, only_binary_reasons);
           if (!only_binary_reasons) {
             vivify_post_process_analysis (c, subsume);
             if (!clause.empty ()) stats.vivifystred2++;
@@ -835,11 +831,8 @@ void Internal::vivify_clause (Vivifier & vivifier, Clause * c) {
     //
     for (const auto & other : *c) {
       assert (val (other) < 0);
-      Var & v = var (other);
-      if (!v.level) continue; // Remove root-level fixed literals.
-      if (v.reason) {         // Remove all negative implied literals.
-        assert (v.level);
-        assert (v.reason);
+      if (!var (other).level) continue; // Remove root-level fixed literals.
+      if (reason (other).clause) {      // Remove negative implied literals.
         LOG ("flushing literal %d", other);
       } else {                                // Decision or unassigned.
         LOG ("keeping literal %d", other);
@@ -122,10 +122,14 @@ unsigned Internal::walk_break_value (int lit) {
 
   unsigned res = 0;             // The computed break-count of 'lit'.
 
+  for (const auto & w : binaries (lit)) {
+    assert (w.blit != lit);
+    if (val (w.blit) <= 0) res++;
+  }
+
   for (auto & w : watches (lit)) {
     assert (w.blit != lit);
     if (val (w.blit) > 0) continue;
-    if (w.binary ()) { res++; continue; }
 
     Clause * c = w.clause;
     assert (lit == c->literals[0]);
@@ -330,45 +334,51 @@ void Internal::walk_flip_lit (Walker & walker, int lit) {
     stats.propagations.walk++;  // propagation (in a one-watch scheme).
 
     int64_t broken = 0;
-    Watches & ws = watches (-lit);
 
-    LOG ("trying to brake %zd watched clauses", ws.size ());
+    // Binary and long clauses are watched in separate lists.
 
-    for (const auto w : ws) {
-      Clause * d = w.clause;
-      LOG (d, "unwatch %d in", -lit);
-      int * literals = d->literals, replacement = 0, prev = -lit;
-      assert (literals[0] == -lit);
-      const int size = d->size;
-      for (int i = 1; i < size; i++) {
-        const int other = literals[i];
-        assert (active (other));
-        literals[i] = prev;             // shift all to right
-        prev = other;
-        const int tmp = val (other);
-        if (tmp < 0) continue;
-        replacement = other;            // satisfying literal
-        break;
-      }
-      if (replacement) {
-        literals[1] = -lit;
-        literals[0] = replacement;
-        assert (-lit != replacement);
-        watch_literal (replacement, -lit, d);
-      } else {
-        for (int i = size-1; i > 0; i--) {      // undo shift
+    for (int binary = 1; binary >= 0; binary--) {
+
+      Watches & ws = binary ? binaries (-lit) : watches (-lit);
+
+      LOG ("trying to brake %zd watched clauses", ws.size ());
+
+      for (const auto w : ws) {
+        Clause * d = w.clause;
+        LOG (d, "unwatch %d in", -lit);
+        int * literals = d->literals, replacement = 0, prev = -lit;
+        assert (literals[0] == -lit);
+        const int size = d->size;
+        for (int i = 1; i < size; i++) {
           const int other = literals[i];
-          literals[i] = prev;
+          assert (active (other));
+          literals[i] = prev;           // shift all to right
           prev = other;
+          const int tmp = val (other);
+          if (tmp < 0) continue;
+          replacement = other;          // satisfying literal
+          break;
+        }
+        if (replacement) {
+          literals[1] = -lit;
+          literals[0] = replacement;
+          assert (-lit != replacement);
+          watch_literal (replacement, -lit, d);
+        } else {
+          for (int i = size-1; i > 0; i--) {    // undo shift
+            const int other = literals[i];
+            literals[i] = prev;
+            prev = other;
+          }
+          assert (literals[0] == -lit);
+          LOG (d, "broken");
+          walker.broken.push_back (d);
+          broken++;
         }
-        assert (literals[0] == -lit);
-        LOG (d, "broken");
-        walker.broken.push_back (d);
-        broken++;
       }
+      ws.clear ();
     }
     LOG ("broken %" PRId64 " clauses by flipping %d", broken, lit);
-    ws.clear ();
   }
 }
 
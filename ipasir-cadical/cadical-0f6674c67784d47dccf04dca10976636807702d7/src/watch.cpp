@@ -4,20 +4,24 @@ namespace CaDiCaL {
 
 void Internal::init_watches () {
   assert (wtab.empty ());
+  assert (bwtab.empty ());
   while (wtab.size () < 2*vsize)
     wtab.push_back (Watches ());
+  while (bwtab.size () < 2*vsize)
+    bwtab.push_back (Watches ());
   LOG ("initialized watcher tables");
 }
 
 void Internal::clear_watches () {
   for (int idx = 1; idx <= max_var; idx++)
     for (int sign = -1; sign <= 1; sign += 2)
-      watches (sign * idx).clear ();
+      watches (sign * idx).clear (), binaries (sign * idx).clear ();
 }
 
 void Internal::reset_watches () {
   assert (!wtab.empty ());
   erase_vector (wtab);
+  erase_vector (bwtab);
   LOG ("reset watcher tables");
 }
 
@@ -71,42 +75,11 @@ void Internal::connect_watches (bool irredundant_only) {
   STOP (connect);
 }
 
-void Internal::sort_watches () {
-  assert (watching ());
-  LOG ("sorting watches");
-  Watches saved;
-  for (int idx = 1; idx <= max_var; idx++) {
-    for (int sign = -1; sign <= 1; sign += 2) {
-
-      const int lit = sign * idx;
-      Watches & ws = watches (lit);
-
-      const const_watch_iterator end = ws.end ();
-      watch_iterator j = ws.begin ();
-      const_watch_iterator i;
-
-      assert (saved.empty ());
-
-      for (i = j; i != end; i++) {
-        const Watch w = *i;
-        if (w.binary ()) *j++ = w;
-        else saved.push_back (w);
-      }
-      ws.resize (j - ws.begin ());
-
-      for (const auto & w : saved)
-        ws.push_back (w);
-
-      saved.clear ();
-    }
-  }
-}
-
 void Internal::disconnect_watches () {
   LOG ("disconnecting watches");
   for (int idx = 1; idx <= max_var; idx++)
     for (int sign = -1; sign <= 1; sign += 2)
-      watches (sign * idx).clear ();
+      watches (sign * idx).clear (), binaries (sign * idx).clear ();
 }
 
 }
@@ -14,9 +14,20 @@ namespace CaDiCaL {
 // however limit the number of clauses to '2^32 - 1'.  One would also need
 // to use at least one more bit (either taken away from the variable space
 // or the clauses) to denote whether the watch is binary.
+//
+// This alternative is available by compiling with '-DWATCH32' (configure
+// option '--watch32').  Then all clauses are allocated in chunks of the
+// arena (see 'arena.hpp') and the 'clause' member of a watch is a 32-bit
+// reference, which uses its least significant bit to denote binary
+// clauses.  It converts to and from clause pointers implicitly and thus
+// code using watches does not have to be changed.  Watches are only 8
+// bytes then and the other literal of a binary clause is still available
+// as blocking literal without accessing the clause.
 
 struct Clause;
 
+#ifndef WATCH32
+
 struct Watch {
 
   Clause * clause; int blit;
@@ -28,6 +39,40 @@ struct Watch {
   bool binary () const { return size == 2; }
 };
 
+#else
+
+class ClauseRef {
+
+  unsigned ref;
+
+public:
+
+  ClauseRef () { }
+  ClauseRef (Clause * c) : ref (Arena::reference (c) | (c->size == 2)) { }
+
+  ClauseRef & operator = (Clause * c) {
+    ref = Arena::reference (c) | (ref & 1);
+    return *this;
+  }
+
+  bool binary () const { return ref & 1; }
+
+  operator Clause * () const { return (Clause *) Arena::dereference (ref); }
+  Clause * operator -> () const { return *this; }
+};
+
+struct Watch {
+
+  int blit; ClauseRef clause;
+
+  Watch (int b, Clause * c) : blit (b), clause (c) { }
+  Watch () { }
+
+  bool binary () const { return clause.binary (); }
+};
+
+#endif
+
 typedef vector<Watch> Watches;          // of one literal
 
 typedef Watches::iterator watch_iterator;
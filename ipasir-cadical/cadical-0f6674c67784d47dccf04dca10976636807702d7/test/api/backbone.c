@@ -0,0 +1,90 @@
+// Check backbone computation against testing each literal separately.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdlib.h>
+
+static int n = 40, m = 150;
+
+static unsigned state = 42;
+
+static int pick (int max) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+// Random 3-CNF with 'n' variables and 'm' clauses plus the clauses
+// '(1 | 2) & (1 | -2)' making '1' a backbone literal which is not a unit.
+//
+static CCaDiCaL * init (unsigned seed, int chunk) {
+  CCaDiCaL * solver = ccadical_init ();
+  if (chunk) ccadical_set_option (solver, "backbonechunk", chunk);
+  state = seed;
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < 3; j++) {
+      const int idx = 3 + pick (n - 2);
+      ccadical_add (solver, pick (2) ? idx : -idx);
+    }
+    ccadical_add (solver, 0);
+  }
+  ccadical_add (solver, 1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  ccadical_add (solver, 1), ccadical_add (solver, -2), ccadical_add (solver, 0);
+  return solver;
+}
+
+static int backbone (CCaDiCaL * solver, int lit) {
+  ccadical_assume (solver, -lit);
+  return ccadical_solve (solver) == 20;
+}
+
+int main () {
+
+  int literals[100];
+
+  for (unsigned seed = 1; seed <= 20; seed++) {
+    CCaDiCaL * solver = init (seed, (seed & 1));
+    const int res = ccadical_backbone (solver, literals, n);
+    CCaDiCaL * checker = init (seed, 0);
+    if (ccadical_solve (checker) == 20) {
+      assert (res == -1);
+      ccadical_release (checker);
+      ccadical_release (solver);
+      continue;
+    }
+    assert (res > 0);
+    assert (literals[0] == 1);
+    int count = 0;
+    for (int idx = 1; idx <= n; idx++) {
+      int lit = 0;
+      if (backbone (checker, idx)) lit = idx;
+      else if (backbone (checker, -idx)) lit = -idx;
+      if (!lit) continue;
+      assert (count < res);
+      assert (literals[count] == lit);
+      count++;
+    }
+    assert (count == res);
+    ccadical_release (checker);
+
+    // The backbone under assumptions contains the assumptions and the
+    // assumptions are reset afterwards.
+    //
+    ccadical_assume (solver, -2);
+    int other = ccadical_backbone (solver, literals, n);
+    assert (other >= res);
+    ccadical_assume (solver, -1);
+    other = ccadical_backbone (solver, literals, n);
+    assert (other == -1);
+    assert (ccadical_failed (solver, -1));
+    assert (ccadical_solve (solver) == 10);
+
+    ccadical_release (solver);
+  }
+
+  return 0;
+}
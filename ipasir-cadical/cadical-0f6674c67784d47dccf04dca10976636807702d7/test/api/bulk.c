@@ -0,0 +1,81 @@
+// Check the non-IPASIR conformant bulk functions in 'ipasir.h'.
+
+#include "../../src/ipasir.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+int main () {
+
+  void * solver = ipasir_init ();
+  int res;
+
+  // Same formula as in 'ctest.c' but all clauses added at once.
+  //
+  const int formula[] = { -1, 2, 0, 1, 2, 0, -1, -2, 0 };
+  ipasir_add_clauses (solver, formula, sizeof formula / sizeof *formula);
+  res = ipasir_solve (solver);
+  assert (res == 10);
+  res = ipasir_val (solver, 1);
+  assert (res == -1);
+  res = ipasir_val (solver, 2);
+  assert (res == 2);
+
+  // Variables beyond the maximum variable are included in the model too.
+  //
+  int vals[3];
+  signed char model[3];
+  ipasir_val_range (solver, 1, 3, vals);
+  assert (vals[0] == -1);
+  assert (vals[1] == 2);
+  assert (vals[2] == ipasir_val (solver, 3));
+  ipasir_model (solver, 2, 3, model);
+  assert (model[0] == 1);
+  assert (model[1] == (vals[2] > 0) - (vals[2] < 0));
+
+  // Clauses may span several calls and mix with 'ipasir_add'.
+  //
+  const int first[] = { 3, 4 }, second[] = { 5, 0, -3 };
+  ipasir_add_clauses (solver, first, 2);
+  ipasir_add_clauses (solver, 0, 0);
+  ipasir_add (solver, -2);
+  ipasir_add_clauses (solver, second, 3);
+  ipasir_add (solver, 0);
+  ipasir_assume (solver, -4);
+  ipasir_assume (solver, -5);
+  res = ipasir_solve (solver);
+  assert (res == 20);
+  res = ipasir_failed (solver, -4);
+  assert (res);
+  res = ipasir_failed (solver, -5);
+  assert (res);
+
+  // A too small buffer still yields the size of the whole core.
+  //
+  int core[2];
+  res = ipasir_failed_core (solver, core, 1);
+  assert (res == 2);
+  assert (core[0] == -4 || core[0] == -5);
+  res = ipasir_failed_core (solver, core, 2);
+  assert (res == 2);
+  assert (core[0] + core[1] == -9);
+
+  // Assumptions given twice are part of the core only once.
+  //
+  ipasir_assume (solver, -4);
+  ipasir_assume (solver, -5);
+  ipasir_assume (solver, -4);
+  res = ipasir_solve (solver);
+  assert (res == 20);
+  res = ipasir_failed_core (solver, core, 2);
+  assert (res == 2);
+  assert (core[0] == -4);
+  assert (core[1] == -5);
+
+  ipasir_release (solver);
+
+  return 0;
+}
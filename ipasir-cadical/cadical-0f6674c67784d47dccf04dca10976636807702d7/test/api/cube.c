@@ -0,0 +1,71 @@
+// Check cube-and-conquer on several threads.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+static int n = 7;
+
+static int ph (int p, int h) {
+  assert (0 <= p), assert (p < n + 1);
+  assert (0 <= h), assert (h < n);
+  return 1 + h * (n+1) + p;
+}
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes, where the first
+// pigeon can be put into an extra hole if 'extra' is non-zero.
+//
+static CCaDiCaL * init (int extra) {
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_set_option (solver, "cube", 1);
+  ccadical_set_option (solver, "cubedepth", 4);
+  ccadical_set_option (solver, "cubethreads", 4);
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        ccadical_add (solver, -ph (p1, h)),
+        ccadical_add (solver, -ph (p2, h)),
+        ccadical_add (solver, 0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      ccadical_add (solver, ph (p, h));
+    if (!p && extra) ccadical_add (solver, extra);
+    ccadical_add (solver, 0);
+  }
+  return solver;
+}
+
+int main () {
+
+  CCaDiCaL * solver = init (0);
+  int res = ccadical_solve (solver);
+  assert (res == 20);
+  ccadical_release (solver);
+
+  // Satisfiable only with the extra hole, which is also assumed away.
+  //
+  const int extra = n * (n + 1) + 1;
+  solver = init (extra);
+  res = ccadical_solve (solver);
+  assert (res == 10);
+  res = ccadical_val (solver, extra);
+  assert (res == extra);
+  for (int h = 0; h < n; h++) {
+    res = ccadical_val (solver, ph (0, h));
+    assert (res == -ph (0, h));
+  }
+  ccadical_assume (solver, -extra);
+  res = ccadical_solve (solver);
+  assert (res == 20);
+  res = ccadical_failed (solver, -extra);
+  assert (res);
+  res = ccadical_solve (solver);
+  assert (res == 10);
+  ccadical_release (solver);
+
+  return 0;
+}
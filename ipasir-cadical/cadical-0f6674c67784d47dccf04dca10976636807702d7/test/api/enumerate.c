@@ -0,0 +1,165 @@
+// Check projected model enumeration against brute force counting.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <string.h>
+
+#define N 12
+#define M 30
+
+static int clauses[M][3];
+
+static unsigned state = 42;
+
+static int pick (int max) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+static int satisfied (unsigned assignment) {
+  for (int i = 0; i < M; i++) {
+    int sat = 0;
+    for (int j = 0; !sat && j < 3; j++) {
+      const int lit = clauses[i][j], idx = lit < 0 ? -lit : lit;
+      const int val = (assignment >> (idx - 1)) & 1;
+      sat = lit < 0 ? !val : val;
+    }
+    if (!sat) return 0;
+  }
+  return 1;
+}
+
+// Projected models are identified by the bits of the projected variables.
+
+static char expected[1 << N], found[1 << N];
+static int projection[N], size, models;
+
+static void check (void * state, const int * lits, int count) {
+  (void) state;
+  for (int i = 0; i < count; i++) {
+    unsigned bits = 0;
+    for (int j = 0; j < size; j++, i++) {
+      const int lit = lits[i], idx = lit < 0 ? -lit : lit;
+      assert (idx == projection[j]);
+      if (lit > 0) bits |= 1u << (idx - 1);
+    }
+    assert (!lits[i]);
+    assert (expected[bits]);
+    assert (!found[bits]);
+    found[bits] = 1;
+    models++;
+  }
+}
+
+static int count (int assumption) {
+  unsigned mask = 0;
+  for (int i = 0; i < size; i++) mask |= 1u << (projection[i] - 1);
+  memset (expected, 0, sizeof expected);
+  int res = 0;
+  for (unsigned assignment = 0; assignment < (1u << N); assignment++) {
+    if (assumption > 0 && !(assignment & (1u << (assumption - 1))))
+      continue;
+    if (!satisfied (assignment)) continue;
+    if (expected[assignment & mask]) continue;
+    expected[assignment & mask] = 1;
+    res++;
+  }
+  return res;
+}
+
+static int enumerate (CCaDiCaL * solver, int all, int limit) {
+  memset (found, 0, sizeof found);
+  models = 0;
+  return ccadical_enumerate (solver, projection, all ? 0 : size,
+                             limit, 0, check);
+}
+
+// Blocking clauses do not take variables of the application.
+
+static void counter (void * state, const int * lits, int count) {
+  for (int i = 0; i < count; i++)
+    if (!lits[i]) ++*(int *) state;
+}
+
+static void fresh (void) {
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  int found = 0;
+  assert (ccadical_enumerate (solver, 0, 0, 0, &found, counter) == 20);
+  assert (found == 3);
+  ccadical_add (solver, -3), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 3) < 0);
+  found = 0;
+  assert (ccadical_enumerate (solver, 0, 0, 0, &found, counter) == 20);
+  assert (found == 3);
+  ccadical_release (solver);
+}
+
+int main () {
+
+  for (unsigned seed = 1; seed <= 10; seed++) {
+
+    state = seed;
+    CCaDiCaL * solver = ccadical_init ();
+    for (int i = 0; i < M; i++) {
+      for (int j = 0; j < 3; j++) {
+        const int idx = 1 + pick (N);
+        clauses[i][j] = pick (2) ? idx : -idx;
+        ccadical_add (solver, clauses[i][j]);
+      }
+      ccadical_add (solver, 0);
+    }
+    for (int i = 1; i <= N; i++) {      // Make sure all variables exist.
+      ccadical_add (solver, i);
+      ccadical_add (solver, -i);
+      ccadical_add (solver, 0);
+    }
+
+    // All models.
+    //
+    size = N;
+    for (int i = 0; i < N; i++) projection[i] = i + 1;
+    int expected_models = count (0);
+    assert (enumerate (solver, 1, 0) == 20);
+    assert (models == expected_models);
+
+    // Projected models in reverse order and again to check that the
+    // blocking clauses of the previous enumeration are gone.
+    //
+    size = 5;
+    for (int i = 0; i < size; i++) projection[i] = 2*size - 2*i;
+    expected_models = count (0);
+    for (int round = 0; round < 2; round++) {
+      assert (enumerate (solver, 0, 0) == 20);
+      assert (models == expected_models);
+    }
+
+    // Under an assumption which is reset afterwards.
+    //
+    const int assumption = projection[0] + 1;
+    ccadical_assume (solver, assumption);
+    assert (enumerate (solver, 0, 0) == 20);
+    assert (models == count (assumption));
+
+    // Stop at the limit.
+    //
+    expected_models = count (0);
+    if (expected_models > 1) {
+      assert (enumerate (solver, 0, expected_models - 1) == 10);
+      assert (models == expected_models - 1);
+    }
+
+    assert (ccadical_solve (solver) == (expected_models ? 10 : 20));
+    ccadical_release (solver);
+  }
+
+  fresh ();
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+// Check importing clauses, e.g., from another solver.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int n = 6;
+
+static int ph (int p, int h) {
+  assert (0 <= p), assert (p < n + 1);
+  assert (0 <= h), assert (h < n);
+  return 1 + h * (n+1) + p;
+}
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+//
+static CCaDiCaL * init () {
+  CCaDiCaL * solver = ccadical_init ();
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        ccadical_add (solver, -ph (p1, h)),
+        ccadical_add (solver, -ph (p2, h)),
+        ccadical_add (solver, 0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      ccadical_add (solver, ph (p, h));
+    ccadical_add (solver, 0);
+  }
+  return solver;
+}
+
+typedef struct Buffer {
+  int * lits;
+  int size, calls;
+} Buffer;
+
+static void learn (void * state, const int * clauses, int size) {
+  Buffer * buffer = (Buffer *) state;
+  buffer->lits = realloc (buffer->lits,
+                          (buffer->size + size) * sizeof *buffer->lits);
+  memcpy (buffer->lits + buffer->size, clauses, size * sizeof *clauses);
+  buffer->size += size;
+}
+
+// Pass on the whole buffer with the first call.
+//
+static const int * import (void * state, int * size) {
+  Buffer * buffer = (Buffer *) state;
+  *size = buffer->calls++ ? 0 : buffer->size;
+  return buffer->lits;
+}
+
+int main () {
+
+  // Learned clauses of the first solver include the empty clause and thus
+  // the second solver becomes inconsistent as soon it imports them.
+  //
+  Buffer learned = { 0, 0, 0 };
+  CCaDiCaL * solver = init ();
+  ccadical_set_learn_batch (solver, &learned, 1000, 1000, learn);
+  int res = ccadical_solve (solver);
+  assert (res == 20);
+  ccadical_release (solver);
+  assert (learned.size > 0);
+
+  solver = init ();
+  ccadical_set_import (solver, &learned, import);
+  res = ccadical_solve (solver);
+  assert (res == 20);
+  assert (learned.calls == 1);
+  ccadical_release (solver);
+  free (learned.lits);
+
+  // Clauses over unknown variables, satisfied and tautological clauses as
+  // well as an unterminated trailing clause are skipped, while falsified
+  // and duplicated literals are removed.
+  //
+  const int clauses[] = { 1, 4, 0, -2, -2, -1, 0, 3, -3, 0, 1, 2, 3, 0, 2 };
+  Buffer imported = { (int *) clauses, sizeof clauses / sizeof *clauses, 0 };
+  solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, 0);
+  ccadical_add (solver, 2), ccadical_add (solver, 3), ccadical_add (solver, 0);
+  ccadical_set_import (solver, &imported, import);
+  res = ccadical_solve (solver);
+  assert (res == 10);
+  assert (imported.calls > 0);
+  res = ccadical_val (solver, 2);
+  assert (res == -2);
+  res = ccadical_val (solver, 3);
+  assert (res == 3);
+  ccadical_set_import (solver, 0, 0);
+  ccadical_release (solver);
+
+  return 0;
+}
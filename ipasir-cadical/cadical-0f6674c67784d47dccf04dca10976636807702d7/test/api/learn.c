@@ -0,0 +1,118 @@
+// Check exporting learned clauses one by one and in batches.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+static int n = 6;
+
+static int ph (int p, int h) {
+  assert (0 <= p), assert (p < n + 1);
+  assert (0 <= h), assert (h < n);
+  return 1 + h * (n+1) + p;
+}
+
+// Pigeon hole formula for 'n+1' pigeons in 'n' holes.
+//
+static CCaDiCaL * init () {
+  CCaDiCaL * solver = ccadical_init ();
+  for (int h = 0; h < n; h++)
+    for (int p1 = 0; p1 < n + 1; p1++)
+      for (int p2 = p1 + 1; p2 < n + 1; p2++)
+        ccadical_add (solver, -ph (p1, h)),
+        ccadical_add (solver, -ph (p2, h)),
+        ccadical_add (solver, 0);
+  for (int p = 0; p < n + 1; p++) {
+    for (int h = 0; h < n; h++)
+      ccadical_add (solver, ph (p, h));
+    ccadical_add (solver, 0);
+  }
+  return solver;
+}
+
+typedef struct Exported {
+  int max_length;
+  int batches, clauses, empty;
+  long literals;
+} Exported;
+
+static void count (Exported * exported, const int * clause) {
+  int size = 0;
+  while (clause[size])
+    exported->literals += clause[size++];
+  assert (size <= exported->max_length);
+  exported->empty += !size;
+  exported->clauses++;
+}
+
+static void learn (void * state, int * clause) {
+  count ((Exported *) state, clause);
+}
+
+static void learn_batch (void * state, const int * clauses, int size) {
+  Exported * exported = (Exported *) state;
+  assert (size > 0);
+  assert (!clauses[size - 1]);
+  exported->batches++;
+  for (const int * p = clauses; p < clauses + size; p++) {
+    count (exported, p);
+    while (*p) p++;
+  }
+}
+
+int main () {
+
+  Exported single = { 100, 0, 0, 0, 0 };
+  CCaDiCaL * solver = init ();
+  ccadical_set_learn (solver, &single, single.max_length, learn);
+  int res = ccadical_solve (solver);
+  assert (res == 20);
+  ccadical_release (solver);
+  assert (single.clauses > 0);
+  assert (single.empty == 1);
+
+  // The same clauses are exported but with fewer calls.
+  //
+  Exported batched = { 100, 0, 0, 0, 0 };
+  solver = init ();
+  ccadical_set_learn_batch (solver, &batched, batched.max_length, 1000,
+                            learn_batch);
+  res = ccadical_solve (solver);
+  assert (res == 20);
+  ccadical_release (solver);
+  assert (batched.batches > 0);
+  assert (batched.batches < batched.clauses);
+  assert (batched.clauses == single.clauses);
+  assert (batched.literals == single.literals);
+  assert (batched.empty == 1);
+
+  // Only the empty clause has glue zero.
+  //
+  Exported empty = { 100, 0, 0, 0, 0 };
+  solver = init ();
+  ccadical_set_learn_batch (solver, &empty, empty.max_length, 0,
+                            learn_batch);
+  res = ccadical_solve (solver);
+  assert (res == 20);
+  ccadical_release (solver);
+  assert (empty.batches == 1);
+  assert (empty.clauses == 1);
+  assert (empty.empty == 1);
+
+  // Short clauses only.
+  //
+  Exported binary = { 2, 0, 0, 0, 0 };
+  solver = init ();
+  ccadical_set_learn (solver, &binary, binary.max_length, learn);
+  res = ccadical_solve (solver);
+  assert (res == 20);
+  ccadical_set_learn (solver, 0, 0, 0);
+  ccadical_release (solver);
+  assert (binary.clauses < single.clauses);
+
+  return 0;
+}
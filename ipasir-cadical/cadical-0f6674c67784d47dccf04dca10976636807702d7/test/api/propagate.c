@@ -0,0 +1,74 @@
+// Check propagating assumptions without searching.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+static int contains (const int * lits, int size, int lit) {
+  for (int i = 0; i < size; i++)
+    if (lits[i] == lit) return 1;
+  return 0;
+}
+
+int main () {
+
+  // Implication chain '1 -> 2 -> 3 -> -4' with the unit '5'.
+  //
+  const int clauses[] = { -1, 2, 0, -2, 3, 0, -3, -4, 0, 5, 0, 6, 7, 0 };
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_add_clauses (solver, clauses, sizeof clauses / sizeof *clauses);
+
+  int implied[8], assumptions[2] = { 1, 4 };
+  int res = ccadical_propagate (solver, assumptions, 1, implied, 8);
+  assert (res == 4);
+  assert (implied[0] == 1);
+  assert (contains (implied, res, 2));
+  assert (contains (implied, res, 3));
+  assert (contains (implied, res, -4));
+
+  // Too small buffers only get the first implied literals.
+  //
+  res = ccadical_propagate (solver, assumptions, 1, implied, 1);
+  assert (res == 4);
+  assert (implied[0] == 1);
+
+  res = ccadical_propagate (solver, assumptions, 2, implied, 8);
+  assert (res == -1);
+
+  // Root level units are not implied by the assumptions.
+  //
+  assumptions[0] = 5;
+  res = ccadical_propagate (solver, assumptions, 1, implied, 8);
+  assert (res == 0);
+  assumptions[0] = -5;
+  res = ccadical_propagate (solver, assumptions, 1, implied, 8);
+  assert (res == -1);
+
+  // Assumptions are used and then reset as by 'solve'.
+  //
+  ccadical_assume (solver, -6);
+  res = ccadical_propagate (solver, 0, 0, implied, 8);
+  assert (res == 2);
+  assert (implied[0] == -6);
+  assert (implied[1] == 7);
+  res = ccadical_solve (solver);
+  assert (res == 10);
+
+  // Simplification keeps implications between frozen variables.
+  //
+  ccadical_freeze (solver, 1), ccadical_freeze (solver, 4);
+  ccadical_simplify (solver);
+  assumptions[0] = 1;
+  res = ccadical_propagate (solver, assumptions, 1, implied, 8);
+  assert (res >= 2);
+  assert (contains (implied, res, 1));
+  assert (contains (implied, res, -4));
+
+  ccadical_release (solver);
+
+  return 0;
+}
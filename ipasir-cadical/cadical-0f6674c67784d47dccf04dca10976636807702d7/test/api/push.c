@@ -0,0 +1,187 @@
+// Check pushing and popping contexts against solving from scratch.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 30
+#define M 100
+#define D 4
+#define C 8
+
+static unsigned state;
+
+static int pick (int max) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+static int base[M][3];
+
+// Clauses of the open contexts.
+
+static int clauses[D][C][3];
+static int sizes[D];
+static int depth;
+
+static void add_clause (CCaDiCaL * solver, const int * lits) {
+  for (int i = 0; i < 3; i++) ccadical_add (solver, lits[i]);
+  ccadical_add (solver, 0);
+}
+
+static void random_clause (int * lits) {
+  for (int i = 0; i < 3; i++) {
+    const int idx = 1 + pick (N);
+    lits[i] = pick (2) ? idx : -idx;
+  }
+}
+
+static CCaDiCaL * init (int collect) {
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_set_option (solver, "popcollect", collect);
+  for (int idx = 1; idx <= N; idx++) ccadical_add (solver, idx);
+  ccadical_add (solver, 0);
+  for (int i = 0; i < M; i++) add_clause (solver, base[i]);
+  return solver;
+}
+
+// Solve the base clauses and the clauses of all open contexts from scratch.
+
+static int scratch (int assumption) {
+  CCaDiCaL * solver = init (0);
+  for (int d = 0; d < depth; d++)
+    for (int i = 0; i < sizes[d]; i++)
+      add_clause (solver, clauses[d][i]);
+  if (assumption) ccadical_assume (solver, assumption);
+  const int res = ccadical_solve (solver);
+  ccadical_release (solver);
+  return res;
+}
+
+static void check_model (CCaDiCaL * solver, int assumption) {
+  for (int i = 0; i < M; i++) {
+    int satisfied = 0;
+    for (int j = 0; j < 3; j++)
+      if (ccadical_val (solver, base[i][j]) > 0) satisfied = 1;
+    assert (satisfied);
+  }
+  for (int d = 0; d < depth; d++)
+    for (int i = 0; i < sizes[d]; i++) {
+      int satisfied = 0;
+      for (int j = 0; j < 3; j++)
+        if (ccadical_val (solver, clauses[d][i][j]) > 0) satisfied = 1;
+      assert (satisfied);
+    }
+  if (assumption) assert (ccadical_val (solver, assumption) > 0);
+}
+
+static void random_contexts (unsigned seed, int collect) {
+  state = seed;
+  for (int i = 0; i < M; i++) random_clause (base[i]);
+  CCaDiCaL * solver = init (collect);
+  depth = 0;
+  for (int round = 0; round < 200; round++) {
+    const int op = pick (4);
+    if (op == 0 && depth < D) {
+      ccadical_push (solver);
+      sizes[depth++] = 0;
+    } else if (op == 1 && depth > 0) {
+      ccadical_pop (solver);
+      depth--;
+    } else if (depth > 0 && sizes[depth - 1] < C) {
+      int * lits = clauses[depth - 1][sizes[depth - 1]++];
+      random_clause (lits);
+      add_clause (solver, lits);
+    }
+    const int idx = 1 + pick (N);
+    const int assumption = pick (3) ? 0 : (pick (2) ? idx : -idx);
+    if (assumption) ccadical_assume (solver, assumption);
+    const int res = ccadical_solve (solver);
+    assert (res == scratch (assumption));
+    if (res == 10) check_model (solver, assumption);
+    else if (assumption) {
+      // Activation literals are never failed, thus the formula of the
+      // open contexts is unsatisfiable if the assumption did not fail.
+      if (!ccadical_failed (solver, assumption))
+        assert (scratch (0) == 20);
+    }
+  }
+  while (depth > 0) ccadical_pop (solver), depth--;
+  assert (ccadical_solve (solver) == scratch (0));
+  ccadical_release (solver);
+}
+
+// Propagation does not report activation literals.
+
+static void propagate (void) {
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_add (solver, -1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  ccadical_push (solver);
+  ccadical_add (solver, -2), ccadical_add (solver, 3), ccadical_add (solver, 0);
+  int assumption = 1, implied[4];
+  int res = ccadical_propagate (solver, &assumption, 1, implied, 4);
+  assert (res == 3);
+  assert (implied[0] == 1 && implied[1] == 2 && implied[2] == 3);
+  ccadical_pop (solver);
+  res = ccadical_propagate (solver, &assumption, 1, implied, 4);
+  assert (res == 2);
+  assert (implied[0] == 1 && implied[1] == 2);
+  ccadical_release (solver);
+}
+
+// Contexts do not take variables of the application.
+
+static void fresh (void) {
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  ccadical_push (solver);
+  ccadical_add (solver, -3), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 3) < 0);
+  ccadical_pop (solver);
+  ccadical_add (solver, 3), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 3) > 0);
+  ccadical_release (solver);
+}
+
+// Many short contexts do not make the formula grow.
+
+static void cycles (void) {
+  state = 42;
+  for (int i = 0; i < M; i++) random_clause (base[i]);
+  CCaDiCaL * solver = init (100);
+  const int res = ccadical_solve (solver);
+  const int64_t irredundant = ccadical_irredundant (solver);
+  const int64_t active = ccadical_active (solver);
+  for (int i = 0; i < 1000; i++) {
+    ccadical_push (solver);
+    for (int j = 0; j < 3; j++) {
+      int lits[3];
+      random_clause (lits);
+      add_clause (solver, lits);
+    }
+    ccadical_solve (solver);
+    ccadical_pop (solver);
+  }
+  assert (ccadical_solve (solver) == res);
+  assert (ccadical_irredundant (solver) <= irredundant);
+  assert (ccadical_active (solver) <= active);
+  ccadical_release (solver);
+}
+
+int main () {
+  for (unsigned seed = 1; seed <= 20; seed++) {
+    random_contexts (seed, 100);
+    random_contexts (seed, 1);
+  }
+  propagate ();
+  fresh ();
+  cycles ();
+  return 0;
+}
@@ -0,0 +1,104 @@
+// Check that cleared and pooled solvers behave like new solvers.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+#define N 40
+#define M 170
+
+static unsigned state;
+
+static int pick (int max) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+static int formula[M][3];
+
+static void random_formula (unsigned seed) {
+  state = seed;
+  for (int i = 0; i < M; i++)
+    for (int j = 0; j < 3; j++) {
+      const int idx = 1 + pick (N);
+      formula[i][j] = pick (2) ? idx : -idx;
+    }
+}
+
+static int solve (CCaDiCaL * solver) {
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < 3; j++) ccadical_add (solver, formula[i][j]);
+    ccadical_add (solver, 0);
+  }
+  const int res = ccadical_solve (solver);
+  if (res == 10)
+    for (int i = 0; i < M; i++) {
+      int satisfied = 0;
+      for (int j = 0; j < 3; j++)
+        if (ccadical_val (solver, formula[i][j]) > 0) satisfied = 1;
+      assert (satisfied);
+    }
+  return res;
+}
+
+static int fresh (void) {
+  CCaDiCaL * solver = ccadical_init ();
+  const int res = solve (solver);
+  ccadical_release (solver);
+  return res;
+}
+
+static int terminate (void * state) { (void) state; return 1; }
+
+int main () {
+
+  // Cleared solvers forget their clauses but keep options, which can also
+  // be set again.
+  //
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_set_option (solver, "elim", 0);
+  ccadical_add (solver, 1), ccadical_add (solver, 0);
+  ccadical_add (solver, -1), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 20);
+  ccadical_clear (solver);
+  assert (!ccadical_get_option (solver, "elim"));
+  ccadical_set_option (solver, "phase", 0);
+  ccadical_add (solver, -1), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 1) < 0);
+
+  // Call-backs are disconnected.
+  //
+  ccadical_set_terminate (solver, 0, terminate);
+  ccadical_clear (solver);
+  for (unsigned seed = 1; seed <= 20; seed++) {
+    random_formula (seed);
+    assert (solve (solver) == fresh ());
+    ccadical_clear (solver);
+  }
+  ccadical_release (solver);
+
+  // Pooled solvers are reused with default options.
+  //
+  ccadical_pool (2);
+  solver = ccadical_init ();
+  ccadical_set_option (solver, "elim", 0);
+  ccadical_release (solver);
+  CCaDiCaL * other = ccadical_init ();
+  assert (other == solver);
+  assert (ccadical_get_option (other, "elim"));
+  for (unsigned seed = 21; seed <= 40; seed++) {
+    random_formula (seed);
+    assert (solve (other) == fresh ());
+    ccadical_release (other);
+    other = ccadical_init ();
+  }
+  ccadical_release (other);
+  ccadical_pool (0);
+
+  return 0;
+}
@@ -109,6 +109,18 @@ run terminate
 run cfreeze
 run traverse
 run apitrace
+run bulk
+run learn
+run import
+run cube
+run propagate
+run backbone
+run enumerate
+run shrink
+run push
+run reset
+run tiny
+run sparse
 
 #--------------------------------------------------------------------------#
 
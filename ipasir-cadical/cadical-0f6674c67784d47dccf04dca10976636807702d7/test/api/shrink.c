@@ -0,0 +1,120 @@
+// Check that shrunken cores of failed assumptions are minimal.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+#define N 100
+#define M 400
+#define A 60
+
+static unsigned state;
+
+static int pick (int max) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+static CCaDiCaL * init (unsigned seed, int automatic) {
+  CCaDiCaL * solver = ccadical_init ();
+  if (automatic) ccadical_set_option (solver, "shrinkcore", 1);
+  state = seed;
+  for (int i = 0; i < M; i++) {
+    for (int j = 0; j < 3; j++) {
+      const int idx = 1 + pick (N);
+      ccadical_add (solver, pick (2) ? idx : -idx);
+    }
+    ccadical_add (solver, 0);
+  }
+  return solver;
+}
+
+// Terminates on the first call only, like an interrupt, and counts calls.
+
+static int polled;
+
+static int terminate (void * state) {
+  (void) state;
+  return !polled++;
+}
+
+static int solve (CCaDiCaL * solver, const int * assumptions, int size) {
+  for (int i = 0; i < size; i++)
+    ccadical_assume (solver, assumptions[i]);
+  return ccadical_solve (solver);
+}
+
+int main () {
+
+  int shrunken = 0;
+
+  for (unsigned seed = 1; seed <= 40; seed++) {
+    for (int automatic = 0; automatic < 2; automatic++) {
+
+      CCaDiCaL * solver = init (seed, automatic);
+
+      // Assumptions on the first 'A' variables with random sign.
+      //
+      int assumptions[A];
+      for (int i = 0; i < A; i++)
+        assumptions[i] = pick (2) ? i + 1 : -(i + 1);
+      if (solve (solver, assumptions, A) != 20) {
+        ccadical_release (solver);
+        continue;
+      }
+
+      int before[A], core[A];
+      const int size = ccadical_failed_core (solver, before, A);
+      const int res = ccadical_shrink_core (solver);
+      assert (res <= size);
+      assert (ccadical_failed_core (solver, core, A) == res);
+      for (int i = 0; i < A; i++) {
+        int found = 0;
+        for (int j = 0; !found && j < res; j++)
+          found = (core[j] == assumptions[i]);
+        assert (ccadical_failed (solver, assumptions[i]) == found);
+      }
+
+      // The core is a subset of the previous core, still unsatisfiable and
+      // minimal, since the conflict limit is large enough for these small
+      // formulas.
+      //
+      for (int i = 0; i < res; i++) {
+        int found = 0;
+        for (int j = 0; !found && j < size; j++)
+          found = (before[j] == core[i]);
+        assert (found);
+      }
+      assert (solve (solver, core, res) == 20);
+      for (int i = 0; i < res; i++) {
+        int subset[A], k = 0;
+        for (int j = 0; j < res; j++)
+          if (j != i) subset[k++] = core[j];
+        assert (solve (solver, subset, k) == 10);
+      }
+
+      if (res < size) shrunken++;
+
+      // Shrinking stops on termination and keeps the failed assumptions.
+      //
+      if (!automatic) {
+        assert (solve (solver, assumptions, A) == 20);
+        const int failed = ccadical_failed_core (solver, core, A);
+        polled = 0;
+        ccadical_set_terminate (solver, 0, terminate);
+        assert (ccadical_shrink_core (solver) == failed);
+        assert (polled == (failed > 1));
+      }
+
+      ccadical_release (solver);
+    }
+  }
+
+  assert (shrunken);
+
+  return 0;
+}
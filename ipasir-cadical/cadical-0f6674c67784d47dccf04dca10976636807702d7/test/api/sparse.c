@@ -0,0 +1,162 @@
+// Check sparse external variable indices against the same formulas over
+// dense indices.  In non-sparse mode variables up to '10^8' would need
+// several gigabytes of memory.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+#include <stdlib.h>
+
+#define N 100
+#define M 400
+#define MAX 100000000
+
+static unsigned state;
+
+static int pick (int max) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+static int ids[N + 1];
+static int formula[M][3];
+
+static int sparse (int lit) { return lit < 0 ? -ids[-lit] : ids[lit]; }
+
+static int dense (int lit) {
+  for (int idx = 1; idx <= N; idx++)
+    if (ids[idx] == abs (lit)) return lit < 0 ? -idx : idx;
+  assert (0);
+  return 0;
+}
+
+static void random_ids (void) {
+  for (int idx = 1; idx <= N; idx++) {
+    int fresh;
+    do {
+      ids[idx] = 1 + (pick (1 << 20) * 95 + pick (95)) % MAX;
+      fresh = 1;
+      for (int other = 1; other < idx; other++)
+        if (ids[other] == ids[idx]) fresh = 0;
+    } while (!fresh);
+  }
+}
+
+static void random_formula (void) {
+  for (int i = 0; i < M; i++)
+    for (int j = 0; j < 3; j++) {
+      const int idx = 1 + pick (N);
+      formula[i][j] = pick (2) ? idx : -idx;
+    }
+}
+
+static void add (CCaDiCaL * a, CCaDiCaL * b, int from, int to) {
+  for (int i = from; i < to; i++) {
+    for (int j = 0; j < 3; j++) {
+      ccadical_add (a, sparse (formula[i][j]));
+      ccadical_add (b, formula[i][j]);
+    }
+    ccadical_add (a, 0);
+    ccadical_add (b, 0);
+  }
+}
+
+static void check_model (CCaDiCaL * solver, int clauses) {
+  for (int i = 0; i < clauses; i++) {
+    int satisfied = 0;
+    for (int j = 0; j < 3; j++)
+      if (ccadical_val (solver, sparse (formula[i][j])) > 0) satisfied = 1;
+    assert (satisfied);
+  }
+}
+
+static void incremental (void) {
+  CCaDiCaL * a = ccadical_init (), * b = ccadical_init ();
+  ccadical_set_option (a, "sparse", 1);
+  ccadical_set_option (a, "tiny", 0);
+  ccadical_set_option (b, "tiny", 0);
+  int clauses = 0;
+  while (clauses < M) {
+    const int batch = 1 + pick (80);
+    const int end = clauses + batch < M ? clauses + batch : M;
+    add (a, b, clauses, end);
+    clauses = end;
+    const int frozen = 1 + pick (N);
+    if (pick (2)) ccadical_freeze (a, ids[frozen]);
+    const int idx = 1 + pick (N), assumption = pick (2) ? idx : -idx;
+    if (pick (2)) {
+      ccadical_assume (a, sparse (assumption));
+      ccadical_assume (b, assumption);
+    }
+    const int res = ccadical_solve (a);
+    assert (res == ccadical_solve (b));
+    if (res == 10) {
+      check_model (a, clauses);
+      for (int other = 1; other <= N; other++) {
+        const int tmp = ccadical_fixed (a, ids[other]);
+        assert (!tmp || (tmp > 0) == (ccadical_val (a, ids[other]) > 0));
+      }
+    } else if (res == 20 && ccadical_failed (a, sparse (assumption)))
+      assert (ccadical_failed (b, assumption));
+    if (ccadical_frozen (a, ids[frozen])) ccadical_melt (a, ids[frozen]);
+    if (res == 20 && !ccadical_failed (b, assumption)) break;
+  }
+  ccadical_release (a);
+  ccadical_release (b);
+}
+
+static void backbone (void) {
+  CCaDiCaL * a = ccadical_init (), * b = ccadical_init ();
+  ccadical_set_option (a, "sparse", 1);
+  add (a, b, 0, 3 * N);
+  int x[N], y[N];
+  const int res = ccadical_backbone (a, x, N);
+  assert (res == ccadical_backbone (b, y, N));
+  for (int i = 0; i < res; i++) {
+    int found = 0;
+    for (int j = 0; j < res; j++)
+      if (sparse (y[j]) == x[i]) found = 1;
+    assert (found);
+    (void) dense (x[i]);
+  }
+  ccadical_release (a);
+  ccadical_release (b);
+}
+
+int main () {
+
+  state = 1;
+  for (int round = 0; round < 20; round++) {
+    random_ids ();
+    random_formula ();
+    incremental ();
+    backbone ();
+  }
+
+  // Large indices and values of unused variables.
+  //
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_set_option (solver, "sparse", 1);
+  ccadical_add (solver, 2000000000), ccadical_add (solver, -7);
+  ccadical_add (solver, 0);
+  ccadical_add (solver, 7), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 2000000000) > 0);
+  assert (ccadical_val (solver, 7) > 0);
+  assert (ccadical_val (solver, 1000000) < 0);
+  int vals[3];
+  ccadical_val_range (solver, 6, 8, vals);
+  assert (vals[0] == -6 && vals[1] == 7 && vals[2] == -8);
+  ccadical_push (solver);
+  ccadical_add (solver, -7), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 20);
+  ccadical_pop (solver);
+  assert (ccadical_solve (solver) == 10);
+  ccadical_release (solver);
+
+  return 0;
+}
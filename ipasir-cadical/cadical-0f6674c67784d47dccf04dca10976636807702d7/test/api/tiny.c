@@ -0,0 +1,162 @@
+// Check the tiny formula engine against the full solver, including moving
+// formulas to the full solver while they grow.
+
+#include "../../src/ccadical.h"
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <assert.h>
+
+#define N 240
+#define M 1200
+
+static unsigned state;
+
+static int pick (int max) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % max;
+}
+
+static int formula[M][3];
+
+static void random_formula (int vars) {
+  for (int i = 0; i < M; i++)
+    for (int j = 0; j < 3; j++) {
+      const int idx = 1 + pick (vars);
+      formula[i][j] = pick (2) ? idx : -idx;
+    }
+}
+
+static void check_model (CCaDiCaL * solver, int clauses, int assumption) {
+  for (int i = 0; i < clauses; i++) {
+    int satisfied = 0;
+    for (int j = 0; j < 3; j++)
+      if (ccadical_val (solver, formula[i][j]) > 0) satisfied = 1;
+    assert (satisfied);
+  }
+  if (assumption) assert (ccadical_val (solver, assumption) > 0);
+}
+
+static int solve (int tiny, int clauses, int assumption) {
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_set_option (solver, "tiny", tiny);
+  for (int i = 0; i < clauses; i++) {
+    for (int j = 0; j < 3; j++) ccadical_add (solver, formula[i][j]);
+    ccadical_add (solver, 0);
+  }
+  if (assumption) ccadical_assume (solver, assumption);
+  const int res = ccadical_solve (solver);
+  if (res == 10) check_model (solver, clauses, assumption);
+  else if (assumption && !ccadical_failed (solver, assumption))
+    assert (solve (0, clauses, 0) == 20);
+  ccadical_release (solver);
+  return res;
+}
+
+// Incrementally adds clauses and solves after each batch, while the
+// formula grows beyond the tiny engine limits.
+
+static void grow (int vars) {
+  random_formula (vars);
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_set_option (solver, "tinyclauses", 200);
+  int clauses = 0;
+  while (clauses < M) {
+    const int batch = 1 + pick (100);
+    for (int i = 0; i < batch && clauses < M; i++, clauses++) {
+      for (int j = 0; j < 3; j++)
+        ccadical_add (solver, formula[clauses][j]);
+      ccadical_add (solver, 0);
+    }
+    const int res = ccadical_solve (solver);
+    assert (res == solve (0, clauses, 0));
+    if (res == 20) break;
+    check_model (solver, clauses, 0);
+    if (!pick (4)) {
+      // Moves a satisfied tiny formula to the full solver.
+      ccadical_fixed (solver, 1);
+      check_model (solver, clauses, 0);
+    }
+  }
+  ccadical_release (solver);
+}
+
+static int terminate (void * state) {
+  (void) state;
+  return 1;
+}
+
+int main () {
+
+  state = 1;
+  for (int round = 0; round < 100; round++) {
+    const int vars = 2 + pick (N);
+    const int clauses = 1 + pick (5 * vars < M ? 5 * vars : M);
+    random_formula (vars);
+    const int idx = 1 + pick (vars);
+    const int assumption = pick (2) ? 0 : (pick (2) ? idx : -idx);
+    const int res = solve (1, clauses, assumption);
+    assert (res == solve (0, clauses, assumption));
+  }
+
+  for (int round = 0; round < 10; round++) grow (20 + pick (60));
+
+  // Unsatisfiable tiny formulas and conflicting assumptions.
+  //
+  CCaDiCaL * solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  ccadical_add (solver, -1), ccadical_add (solver, 0);
+  ccadical_assume (solver, -2);
+  assert (ccadical_solve (solver) == 20);
+  assert (ccadical_failed (solver, -2));
+  ccadical_add (solver, -2), ccadical_add (solver, 0);
+  assert (ccadical_solve (solver) == 20);
+  ccadical_release (solver);
+
+  solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, -2), ccadical_add (solver, 0);
+  ccadical_assume (solver, 2), ccadical_assume (solver, -2);
+  assert (ccadical_solve (solver) == 20);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 7) == -7);
+  ccadical_release (solver);
+
+  // Assumed variables which do not occur in clauses.
+  //
+  solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  ccadical_add (solver, -1), ccadical_add (solver, 3), ccadical_add (solver, 0);
+  ccadical_assume (solver, 50);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 50) == 50);
+  ccadical_assume (solver, -1), ccadical_assume (solver, 40);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 1) == -1);
+  assert (ccadical_val (solver, 2) == 2);
+  assert (ccadical_val (solver, 40) == 40);
+  ccadical_assume (solver, -50);
+  assert (ccadical_solve (solver) == 10);
+  assert (ccadical_val (solver, 50) == -50);
+  ccadical_release (solver);
+
+  // Tiny formulas are still subject to the terminator and interrupts.
+  //
+  solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  ccadical_set_terminate (solver, 0, terminate);
+  assert (ccadical_solve (solver) == 0);
+  ccadical_set_terminate (solver, 0, 0);
+  assert (ccadical_solve (solver) == 10);
+  ccadical_release (solver);
+
+  solver = ccadical_init ();
+  ccadical_add (solver, 1), ccadical_add (solver, 2), ccadical_add (solver, 0);
+  ccadical_terminate (solver);
+  assert (ccadical_solve (solver) == 0);
+  assert (ccadical_solve (solver) == 10);
+  ccadical_release (solver);
+
+  return 0;
+}
@@ -171,6 +171,131 @@ IPASIR_API void ipasir_set_terminate (void * solver, void * state, int (*termina
  */
 IPASIR_API void ipasir_set_learn (void * solver, void * state, int max_length, void (*learn)(void * state, int * clause));
 
+/*
+ * The following functions are non-standard extensions of IPASIR, which are
+ * implemented by all solvers packaged in this project.  They do not add new
+ * functionality but allow to exchange data with the solver in bulk, which
+ * avoids the per call overhead of foreign function interfaces, e.g., JNA.
+ */
+
+/**
+ * Add the literals 'lits[0]', ..., 'lits[size-1]' in this order as if
+ * ipasir_add was called for each of them.  The buffer can contain several
+ * clauses, each terminated by 0.  If the last literal is not 0, the last
+ * clause can be continued with further calls of ipasir_add or
+ * ipasir_add_clauses.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT
+ */
+IPASIR_API void ipasir_add_clauses (void * solver, const int * lits, int size);
+
+/**
+ * Get the truth values of all variables 'from', ..., 'to' in the found
+ * satisfying assignment at once.  The value of the variable 'from + i' is
+ * written to 'vals[i]' and is the same as returned by ipasir_val for it.
+ * The buffer has to provide space for 'to - from + 1' values.
+ *
+ * Required state: SAT
+ * State after: SAT
+ */
+IPASIR_API void ipasir_val_range (void * solver, int from, int to, int * vals);
+
+/**
+ * Same as ipasir_val_range but only the signs of the values are written,
+ * i.e., 1 for True, -1 for False, and 0 if not important, which allows to
+ * copy models using a quarter of the memory.
+ *
+ * Required state: SAT
+ * State after: SAT
+ */
+IPASIR_API void ipasir_model (void * solver, int from, int to, signed char * vals);
+
+/**
+ * Get all assumption literals for which ipasir_failed would return 1 at
+ * once.  At most 'size' of them are written to 'core' and the number of
+ * all failed assumptions is returned.  Thus a buffer with space for all
+ * assumptions used in the last SAT search is always large enough.
+ *
+ * Required state: UNSAT
+ * State after: UNSAT
+ */
+IPASIR_API int ipasir_failed_core (void * solver, int * core, int size);
+
+/**
+ * Same as ipasir_set_learn but the learned clauses are collected and
+ * passed on to 'learn' in batches, to reduce the number of calls.  Each
+ * batch consists of 'size' literals forming 0 terminated clauses, i.e., in
+ * the format of ipasir_add_clauses.  Pending clauses are passed on before
+ * ipasir_solve returns.  Setting this call-back replaces the one set by
+ * ipasir_set_learn and vice versa.  Solvers which do not support exporting
+ * learned clauses never call 'learn'.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_learn_batch (void * solver, void * state, int max_length, void (*learn)(void * state, const int * clauses, int size));
+
+/**
+ * Set a callback function used to import clauses, e.g., clauses learned by
+ * other solvers working on the same formula.  The solver polls 'import'
+ * regularly during the search (on restarts) and adds the returned clauses
+ * as learned clauses.  The callback returns a buffer with '*size' literals
+ * forming 0 terminated clauses, i.e., in the format of ipasir_add_clauses,
+ * which has to stay valid until the next call, or sets '*size' to 0 if
+ * there is nothing to import.  The imported clauses have to be implied by
+ * the formula.  Clauses with variables unknown to the solver are ignored.
+ * Solvers which do not support importing clauses never call 'import'.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_import (void * solver, void * state, const int * (*import)(void * state, int * size));
+
+/**
+ * Poll the callback set by ipasir_set_terminate only after 'conflicts'
+ * conflicts or if 'milliseconds' passed since the last poll, whichever
+ * comes first.  Non-positive values disable the respective condition and
+ * if both are disabled the callback is not polled at all.  By default the
+ * callback is polled on every conflict, which is costly if it is called
+ * through a foreign function interface.  Solvers may count their checks
+ * for termination instead of conflicts, e.g., CaDiCaL, or may poll even
+ * less often, e.g., PicoSAT every 1024 decisions.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_terminate_interval (void * solver, int conflicts, int milliseconds);
+
+/**
+ * Ask the solver to terminate the currently running ipasir_solve, or the
+ * next one if it is not solving, which then returns 0.  Other than the
+ * callback set by ipasir_set_terminate this does not call out of the
+ * solver but only sets an atomic flag, which the solver checks before
+ * that callback.  Thus it can be called at any time from another thread or
+ * a signal handler.  The request is cleared as soon as ipasir_solve
+ * returns.
+ *
+ * Required state: INPUT or SAT or UNSAT or SOLVING
+ * State after: INPUT or SAT or UNSAT or SOLVING
+ */
+IPASIR_API void ipasir_interrupt (void * solver);
+
+/**
+ * Only propagate the 'size' literals in 'assumptions', together with those
+ * added before by ipasir_assume, on top of the literals fixed at the top
+ * level without any search.  Writes at most 'capacity' of the literals
+ * implied by the assumptions (including the assumptions themselves but not
+ * literals fixed at the top level) to 'implied' and returns the number of
+ * all of them, or -1 if propagation leads to a conflict.  Thus calling it
+ * again with a buffer of the returned size gives all implied literals.
+ * As after ipasir_solve all assumptions are cleared.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT
+ */
+IPASIR_API int ipasir_propagate (void * solver, const int * assumptions, int size, int * implied, int capacity);
+
 #ifdef __cplusplus
 } // closing extern "C"
 #endif
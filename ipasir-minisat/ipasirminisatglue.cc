@@ -40,8 +40,23 @@ class IPAsirMiniSAT : public Solver {
     }
   }
   double ps (double s, double t) { return t ? s/t : 0; }
+  // Learned clauses are collected in 'batch' if 'setLearnBatch' is used.
+  enum { BATCH = 1 << 12 };
+  vec<int> batch; void * batchState;
+  void (*batchLearn) (void * state, const int * clauses, int size);
+  static void learned (void * s, int * clause) {
+    IPAsirMiniSAT * solver = (IPAsirMiniSAT*) s;
+    while (*clause) solver->batch.push (*clause++);
+    solver->batch.push (0);
+    if (solver->batch.size () >= BATCH) solver->flush ();
+  }
+  void flush () {
+    if (batch.size ()) batchLearn (batchState, batch, batch.size ());
+    batch.clear ();
+  }
 public:
-  IPAsirMiniSAT () : szfmap (0), fmap (0), nomodel (false), calls (0) {
+  IPAsirMiniSAT () : szfmap (0), fmap (0), nomodel (false), calls (0),
+    batchState (0), batchLearn (0) {
     // MiniSAT by default produces non standard conforming messages.
     // So either we have to set this to '0' or patch the sources.
     verbosity = 0;
@@ -53,6 +68,13 @@ public:
     if (lit) clause.push (import (lit));
     else addClause (clause), clause.clear ();
   }
+  void add (const int * lits, int size) {
+    reset ();
+    nomodel = true;
+    for (const int * p = lits, * end = lits + size; p < end; p++)
+      if (*p) clause.push (import (*p));
+      else addClause (clause), clause.clear ();
+  }
   void assume (int lit) {
     reset ();
     nomodel = true;
@@ -62,21 +84,75 @@ public:
     calls++;
     reset ();
     lbool res = solveLimited (assumptions);
+    clearInterrupt ();
+    flush ();
     assumptions.clear ();
     nomodel = (res != l_True);
     return (res == l_Undef) ? 0 : (res == l_True ? 10 : 20);
   }
   int val (int lit) {
     if (nomodel) return 0;
-    lbool res = modelValue (import (lit));
+    // Do not use 'import' here, which would add variables.
+    int idx = abs (lit);
+    if (idx > model.size ()) return 0;
+    lbool res = model[idx - 1] ^ (lit < 0);
     return (res == l_True) ? lit : -lit;
   }
+  void vals (int from, int to, int * res) {
+    for (int idx = from; idx <= to; idx++) *res++ = val (idx);
+  }
+  void vals (int from, int to, signed char * res) {
+    for (int idx = from; idx <= to; idx++) {
+      int tmp = val (idx);
+      *res++ = (tmp > 0) - (tmp < 0);
+    }
+  }
   int failed (int lit) {
     if (!fmap) ana ();
     int tmp = var (import (lit));
     assert (0 <= tmp && tmp < nVars ());
     return fmap[tmp] != 0;
   }
+  void setLearnBatch (void * state, int max_length,
+                      void (*learn)(void * state, const int * clauses, int size)) {
+    batchState = state, batchLearn = learn;
+    if (learn) setLearnCallback (this, max_length, learned);
+    else setLearnCallback (0, max_length, 0);
+  }
+  int failed (int * core, int size) {
+    // The final conflict contains the negations of failed assumptions.
+    for (int i = 0; i < conflict.size () && i < size; i++) {
+      Lit lit = conflict[i];
+      core[i] = sign (lit) ? var (lit) + 1 : -(var (lit) + 1);
+    }
+    return conflict.size ();
+  }
+  // Same as 'implies' but the assumptions themselves are included.
+  int propagate (const int * lits, int size, int * implied, int capacity) {
+    reset ();
+    nomodel = true;
+    for (int i = 0; i < size; i++) assumptions.push (import (lits[i]));
+    int res = -1;
+    if (okay ()) {
+      newDecisionLevel ();
+      bool consistent = true;
+      for (int i = 0; consistent && i < assumptions.size (); i++) {
+        Lit lit = assumptions[i];
+        if (value (lit) == l_False) consistent = false;
+        else if (value (lit) == l_Undef) uncheckedEnqueue (lit);
+      }
+      if (consistent && Solver::propagate () == CRef_Undef) {
+        res = 0;
+        for (int i = trail_lim[0]; i < trail.size (); i++, res++) {
+          Lit lit = trail[i];
+          if (res < capacity) implied[res] = sign (lit) ? -(var (lit) + 1) : var (lit) + 1;
+        }
+      }
+      cancelUntil (0);
+    }
+    assumptions.clear ();
+    return res;
+  }
 };
 
 extern "C" {
@@ -87,9 +163,18 @@ void * ipasir_init () { return new IPAsirMiniSAT (); }
 void ipasir_release (void * s) { delete import (s); }
 int ipasir_solve (void * s) { return import (s)->solve (); }
 void ipasir_add (void * s, int l) { import (s)->add (l); }
+void ipasir_add_clauses (void * s, const int * l, int n) { import (s)->add (l, n); }
 void ipasir_assume (void * s, int l) { import (s)->assume (l); }
 int ipasir_val (void * s, int l) { return import (s)->val (l); }
+void ipasir_val_range (void * s, int f, int t, int * v) { import (s)->vals (f, t, v); }
+void ipasir_model (void * s, int f, int t, signed char * v) { import (s)->vals (f, t, v); }
 int ipasir_failed (void * s, int l) { return import (s)->failed (l); }
+int ipasir_failed_core (void * s, int * c, int n) { return import (s)->failed (c, n); }
 void ipasir_set_terminate (void * s, void * state, int (*callback)(void * state)) { import(s)->setTermCallback(state, callback); }
 void ipasir_set_learn (void * s, void * state, int max_length, void (*learn)(void * state, int * clause)) { import(s)->setLearnCallback(state, max_length, learn); }
+void ipasir_set_learn_batch (void * s, void * state, int max_length, void (*learn)(void * state, const int * clauses, int size)) { import(s)->setLearnBatch(state, max_length, learn); }
+void ipasir_set_import (void * s, void * state, const int * (*callback)(void * state, int * size)) { import(s)->setImportCallback(state, callback); }
+void ipasir_set_terminate_interval (void * s, int conflicts, int milliseconds) { import(s)->setTermCallbackPolling(conflicts > 0 ? conflicts : 0, milliseconds > 0 ? milliseconds / 1e3 : 0); }
+void ipasir_interrupt (void * s) { import(s)->interrupt(); }
+int ipasir_propagate (void * s, const int * a, int n, int * i, int c) { return import(s)->propagate(a, n, i, c); }
 };
@@ -19,6 +19,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 **************************************************************************************************/
 
 #include <math.h>
+#include <chrono>
 
 #include "minisat/mtl/Alg.h"
 #include "minisat/mtl/Sort.h"
@@ -53,7 +54,7 @@ static IntOption     opt_min_learnts_lim   (_cat, "min-learnts", "Minimum learnt
 
 Solver::Solver() :
 
-    termCallback (NULL), learnCallbackBuffer (NULL), learnCallback (NULL)
+    termCallback (NULL), termCallbackPeriod (1), termCallbackInterval (0), learnCallbackBuffer (NULL), learnCallback (NULL), importCallback (NULL)
     // Parameters (user settable):
     //
   , verbosity        (0)
@@ -102,6 +103,9 @@ Solver::Solver() :
   , conflict_budget    (-1)
   , propagation_budget (-1)
   , asynch_interrupt   (false)
+  , termCallbackChecked (0)
+  , termCallbackPolled (0)
+  , termCallbackTime   (0)
 {}
 
 
@@ -688,6 +692,86 @@ bool Solver::simplify()
 }
 
 
+/*_________________________________________________________________________________________________
+|
+|  termCallbackDue : () ->  [bool]
+|
+|  Description:
+|    Poll 'termCallback' if 'termCallbackPeriod' conflicts or 'termCallbackInterval' seconds
+|    passed since the last poll. Called at most once per conflict by 'withinBudget()', which
+|    otherwise would call out on every decision. The first check of each 'solve_()' call and
+|    every check after a termination request always polls. Returns TRUE if termination is
+|    requested.
+|________________________________________________________________________________________________@*/
+bool Solver::termCallbackDue() const
+{
+    bool   due = termCallbackChecked == UINT64_MAX ||
+                 (termCallbackPeriod > 0 && conflicts - termCallbackPolled >= termCallbackPeriod);
+    termCallbackChecked = conflicts;
+    double now = 0;
+    if (termCallbackInterval > 0){
+        now = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (now - termCallbackTime >= termCallbackInterval) due = true; }
+    if (!due) return false;
+    termCallbackPolled = conflicts;
+    termCallbackTime   = now;
+    if (termCallback(termCallbackState) == 0) return false;
+    termCallbackChecked = UINT64_MAX;
+    return true;
+}
+
+
+/*_________________________________________________________________________________________________
+|
+|  importClauses : () ->  [bool]
+|
+|  Description:
+|    Poll 'importCallback' for clauses, e.g., learnt by other solvers, and add them as learnt
+|    clauses. The clauses have to be implied by the problem. Clauses over unknown variables are
+|    ignored. Returns FALSE if an imported clause is falsified.
+|________________________________________________________________________________________________@*/
+bool Solver::importClauses()
+{
+    assert(decisionLevel() == 0);
+    int size = 0;
+    const int* lits = importCallback(importCallbackState, &size);
+    vec<Lit> ps;
+    for (int i = 0; ok && i < size; i++){
+        bool skip = false;
+        ps.clear();
+        for (; i < size && lits[i]; i++){
+            Var v = (lits[i] < 0 ? -lits[i] : lits[i]) - 1;
+            if (v >= nVars()) skip = true;
+            else ps.push(mkLit(v, lits[i] < 0));
+        }
+        if (i == size || skip) continue;
+
+        // Remove duplicates and false literals, skip satisfied clauses and tautologies:
+        sort(ps);
+        Lit p; int j, k;
+        for (j = k = 0, p = lit_Undef; j < ps.size(); j++)
+            if (value(ps[j]) == l_True || ps[j] == ~p)
+                break;
+            else if (value(ps[j]) != l_False && ps[j] != p)
+                ps[k++] = p = ps[j];
+        if (j < ps.size()) continue;
+        ps.shrink(j - k);
+
+        if (ps.size() == 0)
+            ok = false;
+        else if (ps.size() == 1)
+            uncheckedEnqueue(ps[0]);
+        else{
+            CRef cr = ca.alloc(ps, true);
+            learnts.push(cr);
+            attachClause(cr);
+            claBumpActivity(ca[cr]);
+        }
+    }
+    return ok;
+}
+
+
 /*_________________________________________________________________________________________________
 |
 |  search : (nof_conflicts : int) (params : const SearchParams&)  ->  [lbool]
@@ -709,6 +793,9 @@ lbool Solver::search(int nof_conflicts)
     vec<Lit>    learnt_clause;
     starts++;
 
+    if (importCallback != NULL && !importClauses())
+        return l_False;
+
     for (;;){
         CRef confl = propagate();
         if (confl != CRef_Undef){
@@ -855,6 +942,7 @@ lbool Solver::solve_()
     if (!ok) return l_False;
 
     solves++;
+    termCallbackChecked = UINT64_MAX;   // Poll 'termCallback' on the first check of this call.
 
     max_learnts = nClauses() * learntsize_factor;
     if (max_learnts < min_learnts_lim)
@@ -21,6 +21,8 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #ifndef Minisat_Solver_h
 #define Minisat_Solver_h
 
+#include <atomic>
+
 #include "minisat/mtl/Vec.h"
 #include "minisat/mtl/Heap.h"
 #include "minisat/mtl/Alg.h"
@@ -44,6 +46,16 @@ public:
       this->termCallback = termCallback;
     }
 
+    // The terminate call-back is polled at most once per conflict, and only after
+    // 'termCallbackPeriod' conflicts or 'termCallbackInterval' seconds passed since the
+    // last poll, whichever comes first (zero disables the respective condition).
+    uint64_t termCallbackPeriod;
+    double termCallbackInterval;
+    void setTermCallbackPolling(uint64_t period, double interval) {
+      this->termCallbackPeriod = period;
+      this->termCallbackInterval = interval;
+    }
+
     void* learnCallbackState;
     int* learnCallbackBuffer;
     int learnCallbackLimit;
@@ -55,6 +67,13 @@ public:
       this->learnCallback = learn;
     }
 
+    void* importCallbackState;
+    const int* (*importCallback)(void* state, int* size);
+    void setImportCallback(void* state, const int* (*import)(void* state, int* size)) {
+      this->importCallbackState = state;
+      this->importCallback = import;
+    }
+
     // Constructor/Destructor:
     //
     Solver();
@@ -252,7 +271,10 @@ protected:
     //
     int64_t             conflict_budget;    // -1 means no budget.
     int64_t             propagation_budget; // -1 means no budget.
-    bool                asynch_interrupt;
+    std::atomic<bool>   asynch_interrupt;   // Set by 'interrupt()', possibly from another thread.
+    mutable uint64_t    termCallbackChecked; // Conflicts at the last check whether to poll 'termCallback' (or UINT64_MAX).
+    mutable uint64_t    termCallbackPolled;  // Conflicts at the last poll of 'termCallback'.
+    mutable double      termCallbackTime;    // Time of the last poll of 'termCallback'.
 
     // Main internal methods:
     //
@@ -266,6 +288,7 @@ protected:
     void     analyze          (CRef confl, vec<Lit>& out_learnt, int& out_btlevel);    // (bt = backtrack)
     void     analyzeFinal     (Lit p, LSet& out_conflict);                             // COULD THIS BE IMPLEMENTED BY THE ORDINARIY "analyze" BY SOME REASONABLE GENERALIZATION?
     bool     litRedundant     (Lit p);                                                 // (helper method for 'analyze()')
+    bool     importClauses    ();                                                      // Add clauses from 'importCallback' as learnt clauses (at level 0).
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
@@ -297,6 +320,7 @@ protected:
     int      level            (Var x) const;
     double   progressEstimate ()      const; // DELETE THIS ?? IT'S NOT VERY USEFUL ...
     bool     withinBudget     ()      const;
+    bool     termCallbackDue  ()      const; // Poll 'termCallback' if due (helper method for 'withinBudget()').
     void     relocAll         (ClauseAllocator& to);
 
     // Static helpers:
@@ -386,11 +410,11 @@ inline void     Solver::setDecisionVar(Var v, bool b)
 }
 inline void     Solver::setConfBudget(int64_t x){ conflict_budget    = conflicts    + x; }
 inline void     Solver::setPropBudget(int64_t x){ propagation_budget = propagations + x; }
-inline void     Solver::interrupt(){ asynch_interrupt = true; }
-inline void     Solver::clearInterrupt(){ asynch_interrupt = false; }
+inline void     Solver::interrupt(){ asynch_interrupt.store(true, std::memory_order_relaxed); }
+inline void     Solver::clearInterrupt(){ asynch_interrupt.store(false, std::memory_order_relaxed); }
 inline void     Solver::budgetOff(){ conflict_budget = propagation_budget = -1; }
 inline bool     Solver::withinBudget() const {
-    return !asynch_interrupt && (termCallback == NULL || 0 == termCallback(termCallbackState)) &&
+    return !asynch_interrupt.load(std::memory_order_relaxed) && (termCallback == NULL || conflicts == termCallbackChecked || !termCallbackDue()) &&
            (conflict_budget    < 0 || conflicts < (uint64_t)conflict_budget) &&
            (propagation_budget < 0 || propagations < (uint64_t)propagation_budget); }
 
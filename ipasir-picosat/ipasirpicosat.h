@@ -0,0 +1,59 @@
+/* Non-standard functions of the PicoSAT library in addition to 'ipasir.h'.
+ * They give in-process access to the algorithms otherwise only available
+ * through the 'picomus' and 'picomcs' binaries of PicoSAT.
+ */
+#ifndef ipasirpicosat_h_INCLUDED
+#define ipasirpicosat_h_INCLUDED
+
+#include "ipasir.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Compute a minimal unsatisfiable subset (MUS) of the 'size' literals in
+ * 'assumptions', i.e., a subset of them which is unsatisfiable together
+ * with the clauses added so far while dropping any of its literals makes it
+ * satisfiable.  Writes at most 'capacity' literals of the MUS to 'mus' and
+ * returns the number of all of them, which is zero if the clauses are
+ * unsatisfiable without assumptions.  Returns -1 if the clauses are
+ * satisfiable under all assumptions and -2 if this first check is
+ * interrupted.
+ *
+ * If 'progress' is non-zero it is called with 'state' and the zero
+ * terminated current unsatisfiable subset every time it gets smaller.  If
+ * 'seconds' is positive the computation is interrupted after that many
+ * seconds (or through ipasir_interrupt and the ipasir_set_terminate
+ * callback) and the returned subset is unsatisfiable but not necessarily
+ * minimal.  Afterwards ipasir_failed holds exactly for the literals of the
+ * returned subset.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: UNSAT (INPUT if -1 or -2 is returned)
+ */
+IPASIR_API int ipasir_picosat_mus (void * solver, const int * assumptions, int size, int * mus, int capacity, void * state, void (*progress)(void * state, const int * mus), double seconds);
+
+/**
+ * Enumerate the minimal correcting subsets (MCS) of the 'size' literals in
+ * 'assumptions', i.e., the minimal subsets of them which have to be dropped
+ * to make the remaining assumptions satisfiable together with the clauses
+ * added so far, as 'picomcs' does.  Each MCS is passed on as zero
+ * terminated list of literals to 'mcs' together with 'state'.  The clauses
+ * blocking already found MCSes are removed at the end, which uses one new
+ * variable fixed to true.  Returns 20 if all MCSes were enumerated, 10 if
+ * 'limit' (if positive) MCSes were enumerated and 0 if interrupted, either
+ * after 'seconds' (if positive) or through ipasir_interrupt and the
+ * ipasir_set_terminate callback.  The union of all MCSes is the union of
+ * all MUSes.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT
+ */
+IPASIR_API int ipasir_picosat_mcs (void * solver, const int * assumptions, int size, int limit, void * state, void (*mcs)(void * state, const int * mcs), double seconds);
+
+#ifdef __cplusplus
+} // closing extern "C"
+#endif
+
+#endif
@@ -1,48 +1,251 @@
 #include "ipasir.h"
+#include "ipasirpicosat.h"
 #include "picosat.h"
 
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+
 static const char * sig = "picosat" VERSION;
 
+/* The solver handle wraps PicoSAT in order to support asynchronous
+ * termination through the interrupt call-back of PicoSAT, which is always
+ * set and which PicoSAT only checks every 1024 decisions anyhow.  The
+ * 'interrupted' flag is atomic and checked first, so 'ipasir_interrupt' is
+ * lock-free and does not depend on the user call-back.  The 'deadline'
+ * (if non-zero) bounds the time of 'ipasir_picosat_mus'.
+ */
+typedef struct IPAsirPicoSAT {
+  PicoSAT * picosat;
+  atomic_int interrupted;
+  double deadline;
+  void * state;
+  int (*terminate) (void * state);
+} IPAsirPicoSAT;
+
+static IPAsirPicoSAT * import (void * solver) {
+  return (IPAsirPicoSAT *) solver;
+}
+
+#define PS(solver) (import (solver)->picosat)
+
+static double wall_clock_time () {
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+static int terminating (void * solver) {
+  IPAsirPicoSAT * s = import (solver);
+  if (atomic_load_explicit (&s->interrupted, memory_order_relaxed))
+    return 1;
+  if (s->deadline > 0 && wall_clock_time () >= s->deadline)
+    return 1;
+  return s->terminate ? s->terminate (s->state) : 0;
+}
+
+/* Not part of 'ipasir.h' but used by the portfolio to configure PicoSAT.
+ */
+PicoSAT * ipasir_picosat (void * solver) { return PS (solver); }
+
 const char * ipasir_signature () { return sig; }
 
 void * ipasir_init () { 
   char prefix[80];
-  void * res = picosat_init ();
+  IPAsirPicoSAT * res = calloc (1, sizeof *res);
+  res->picosat = picosat_init ();
   sprintf (prefix, "c [%s] ", sig);
-  picosat_set_prefix (res, prefix);
-  picosat_set_verbosity (res, 0);
-  picosat_set_output (res, stdout);
+  picosat_set_prefix (res->picosat, prefix);
+  picosat_set_verbosity (res->picosat, 0);
+  picosat_set_output (res->picosat, stdout);
+  picosat_set_interrupt (res->picosat, res, terminating);
   return res;
 }
 
 void ipasir_release (void * solver) {
-  // picosat_stats (solver);
-  picosat_reset (solver);
+  // picosat_stats (PS (solver));
+  picosat_reset (PS (solver));
+  free (solver);
 }
 
-void ipasir_add (void * solver, int lit) { picosat_add (solver, lit); }
+void ipasir_add (void * solver, int lit) { picosat_add (PS (solver), lit); }
 
-void ipasir_assume (void * solver, int lit) { picosat_assume (solver, lit); }
+void ipasir_add_clauses (void * solver, const int * lits, int size) {
+  const int * p = lits, * end = lits + size, * q;
+  while (p < end) {
+    for (q = p; q < end && *q; q++)
+      ;
+    if (q == end) {
+      /* last clause is not terminated yet */
+      while (p < end) picosat_add (PS (solver), *p++);
+    } else {
+      (void) picosat_add_lits (PS (solver), (int *) p);
+      p = q + 1;
+    }
+  }
+}
 
-int ipasir_solve (void * solver) { return picosat_sat (solver, -1); }
+void ipasir_assume (void * solver, int lit) {
+  picosat_assume (PS (solver), lit);
+}
+
+int ipasir_solve (void * solver) {
+  int res = picosat_sat (PS (solver), -1);
+  atomic_store (&import (solver)->interrupted, 0);
+  return res;
+}
 
 int ipasir_failed (void * solver, int lit) {
-  return picosat_failed_assumption (solver, lit);
+  return picosat_failed_assumption (PS (solver), lit);
+}
+
+int ipasir_failed_core (void * solver, int * core, int size) {
+  const int * p = picosat_failed_assumptions (PS (solver));
+  int res = 0;
+  for (; *p; p++, res++)
+    if (res < size) core[res] = *p;
+  return res;
 }
 
 int ipasir_val (void * solver, int var) {
-  int val = picosat_deref (solver, var);
+  int val = picosat_deref (PS (solver), var);
   if (!val) return 0;
   return val < 0 ? -var : var;
 }
 
+void ipasir_val_range (void * solver, int from, int to, int * vals) {
+  int idx;
+  for (idx = from; idx <= to; idx++) *vals++ = ipasir_val (solver, idx);
+}
+
+void ipasir_model (void * solver, int from, int to, signed char * vals) {
+  int idx;
+  for (idx = from; idx <= to; idx++) *vals++ = picosat_deref (PS (solver), idx);
+}
+
 void
 ipasir_set_terminate (
   void * solver,
   void * state, int (*terminate)(void * state)) {
-  picosat_set_interrupt (solver, state, terminate);
+  import (solver)->state = state;
+  import (solver)->terminate = terminate;
+}
+
+/* PicoSAT checks for termination only every 1024 decisions anyhow */
+void ipasir_set_terminate_interval (void * solver, int conflicts, int milliseconds) {}
+
+void ipasir_interrupt (void * solver) {
+  atomic_store (&import (solver)->interrupted, 1);
+}
+
+int ipasir_propagate (void * solver, const int * assumptions, int size,
+                      int * implied, int capacity) {
+  int i;
+  for (i = 0; i < size; i++)
+    picosat_assume (PS (solver), assumptions[i]);
+  return picosat_propagate (PS (solver), implied, capacity);
+}
+
+/* The deletion based MUS extraction of 'picomus' but only on assumptions.
+ * Interrupts during 'picosat_mus_assumptions' stop minimization early.
+ */
+int ipasir_picosat_mus (void * solver, const int * assumptions, int size,
+                        int * mus, int capacity,
+                        void * state, void (*progress)(void *, const int *),
+                        double seconds) {
+  IPAsirPicoSAT * s = import (solver);
+  const int * p;
+  int i, res;
+  s->deadline = seconds > 0 ? wall_clock_time () + seconds : 0;
+  for (i = 0; i < size; i++)
+    picosat_assume (s->picosat, assumptions[i]);
+  res = picosat_sat (s->picosat, -1);
+  if (res == PICOSAT_UNSATISFIABLE) {
+    p = picosat_mus_assumptions (s->picosat, state, progress, 0);
+    for (res = 0; *p; p++, res++)
+      if (res < capacity) mus[res] = *p;
+  } else res = res ? -1 : -2;
+  s->deadline = 0;
+  atomic_store (&s->interrupted, 0);
+  return res;
+}
+
+/* Grows a maximal satisfiable subset of the assumptions 'a' (marked in
+ * 'in') under '-act', which activates the blocking clauses.  Returns 10 on
+ * success, 20 if already '-act' is unsatisfiable and 0 if interrupted.
+ */
+static int grow (PicoSAT * ps, int act, const int * a, int n, char * in) {
+  int i, j, res;
+  picosat_assume (ps, -act);
+  res = picosat_sat (ps, -1);
+  if (res != PICOSAT_SATISFIABLE) return res;
+  for (i = 0; i < n; i++) in[i] = picosat_deref (ps, a[i]) > 0;
+  for (i = 0; i < n; i++) {
+    if (in[i]) continue;
+    picosat_assume (ps, -act);
+    for (j = 0; j < n; j++)
+      if (in[j]) picosat_assume (ps, a[j]);
+    picosat_assume (ps, a[i]);
+    res = picosat_sat (ps, -1);
+    if (!res) return 0;
+    if (res == PICOSAT_UNSATISFIABLE) continue;
+    for (j = i; j < n; j++)
+      if (picosat_deref (ps, a[j]) > 0) in[j] = 1;
+  }
+  return PICOSAT_SATISFIABLE;
+}
+
+/* Enumerates minimal correcting subsets as 'picomcs' does, i.e., the
+ * complements of maximal satisfiable subsets, each of which is blocked
+ * afterwards.  Other than 'picosat_next_minimal_correcting_subset_of_assumptions'
+ * the blocking clauses are guarded by the new variable 'act', which is
+ * fixed at the end, so the formula stays usable afterwards.
+ */
+int ipasir_picosat_mcs (void * solver, const int * assumptions, int size,
+                        int limit,
+                        void * state, void (*mcs)(void *, const int *),
+                        double seconds) {
+  IPAsirPicoSAT * s = import (solver);
+  PicoSAT * ps = s->picosat;
+  int i, j, n, act, res, count, max_var;
+  int * a, * m;
+  char * in;
+  s->deadline = seconds > 0 ? wall_clock_time () + seconds : 0;
+  a = malloc ((size + 1) * sizeof *a);
+  m = malloc ((size + 1) * sizeof *m);
+  in = malloc (size + 1);
+  for (i = n = 0; i < size; i++) {
+    for (j = 0; j < n && a[j] != assumptions[i]; j++)
+      ;
+    if (j == n) a[n++] = assumptions[i];
+  }
+  max_var = picosat_variables (ps);
+  for (i = 0; i < n; i++)
+    if (abs (a[i]) > max_var) max_var = abs (a[i]);
+  picosat_adjust (ps, max_var);
+  act = picosat_inc_max_var (ps);
+  for (count = 0; ; count++) {
+    if (limit > 0 && count >= limit) { res = PICOSAT_SATISFIABLE; break; }
+    res = grow (ps, act, a, n, in);
+    if (res != PICOSAT_SATISFIABLE) break;
+    for (i = j = 0; i < n; i++)
+      if (!in[i]) m[j++] = a[i];
+    m[j] = 0;
+    if (mcs) mcs (state, m);
+    picosat_add (ps, act);
+    (void) picosat_add_lits (ps, m);
+  }
+  picosat_add (ps, act);
+  picosat_add (ps, 0);
+  free (in);
+  free (m);
+  free (a);
+  s->deadline = 0;
+  atomic_store (&s->interrupted, 0);
+  return res;
 }
 
 /* Picosat does not implement clause sharing functionality */
 void ipasir_set_learn (void * solver, void * state, int max_length, void (*learn)(void * state, int * clause)) {}
-
+void ipasir_set_learn_batch (void * solver, void * state, int max_length, void (*learn)(void * state, const int * clauses, int size)) {}
+void ipasir_set_import (void * solver, void * state, const int * (*import)(void * state, int * size)) {}
@@ -7151,6 +7151,65 @@ picosat_sat (PS * ps, int l)
   return res;
 }
 
+int
+picosat_propagate (PS * ps, int * implied, int capacity)
+{
+  Lit ** p, * lit;
+  size_t start;
+  int res;
+
+  enter (ps);
+
+  ABORTIF (ps->added < ps->ahead, "API usage: incomplete clause");
+  ABORTIF (capacity < 0, "API usage: negative capacity");
+  ABORTIF (capacity && !implied, "API usage: zero implied buffer");
+
+  if (ps->state != READY)
+    reset_incremental_usage (ps);
+
+  assume_contexts (ps);
+
+  if (!ps->conflict)
+    bcp (ps);
+
+  if (ps->conflict)
+    backtrack (ps);
+
+  res = -1;
+  if (!ps->mtcls)
+    {
+      start = ps->thead - ps->trail;	/* trail might be enlarged */
+      for (p = ps->als; p < ps->alshead; p++)
+	{
+	  lit = *p;
+	  if (lit->val == TRUE)
+	    continue;
+	  if (lit->val == FALSE)
+	    break;
+	  assign_decision (ps, lit);
+	  bcp (ps);
+	  if (ps->conflict)
+	    break;
+	}
+
+      if (p == ps->alshead)
+	{
+	  res = 0;
+	  for (p = ps->trail + start; p < ps->thead; p++, res++)
+	    if (res < capacity)
+	      implied[res] = LIT2INT (*p);
+	}
+
+      if (ps->LEVEL)
+	undo (ps, 0);
+    }
+
+  ps->state = UNKNOWN;
+  leave (ps);
+
+  return res;
+}
+
 int
 picosat_res (PS * ps)
 {
@@ -7347,6 +7406,7 @@ const int *
 picosat_mus_assumptions (PS * ps, void * s, void (*cb)(void*,const int*), int fix)
 {
   int i, j, ilit, len, norig = ps->alshead - ps->als, nwork, * work, res;
+  int (*interrupted) (void *);
   signed char * redundant;
   Lit ** p, * lit;
   int failed;
@@ -7433,6 +7493,14 @@ picosat_mus_assumptions (PS * ps, void * s, void (*cb)(void*,const int*), int fi
 	      picosat_add (ps, 0);
 	    }
 	}
+      else if (!res)
+	{
+	  if (ps->verbosity)
+	     fprintf (ps->out,
+		     "%sinterrupted while trying to drop %d%s assumption %d\n",
+		     ps->prefix, i, enumstr (i), work[i]);
+	  break;
+	}
       else
 	{
 	  assert (res == 20);
@@ -7515,11 +7583,14 @@ picosat_mus_assumptions (PS * ps, void * s, void (*cb)(void*,const int*), int fi
   for (i = 0; i < len; i++)
     picosat_assume (ps, ps->mass[i]);
 
+  interrupted = ps->interrupt.function;
+  ps->interrupt.function = 0;
 #ifndef NDEBUG
   res = 
 #endif
   picosat_sat (ps, -1);
   assert (res == 20);
+  ps->interrupt.function = interrupted;
 
   if (!ps->mtcls)
     {
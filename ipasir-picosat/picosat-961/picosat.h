@@ -432,6 +432,16 @@ int picosat_sat (PicoSAT *, int decision_limit);
  */
 void picosat_set_propagation_limit (PicoSAT *, unsigned long long limit);
 
+/* Only propagate the assumptions (see 'picosat_assume') on top of the top
+ * level assignment without any search.  Writes at most 'capacity' of the
+ * literals implied by the assumptions (including the assumptions not
+ * assigned at the top level) to 'implied' in assignment order and returns
+ * the number of all of them, or -1 if propagation leads to a conflict.
+ * Afterwards the solver is in the same state as after 'picosat_sat'
+ * returned 'PICOSAT_UNKNOWN', thus the assumptions are reset.
+ */
+int picosat_propagate (PicoSAT *, int * implied, int capacity);
+
 /* Return last result of calling 'picosat_sat' or '0' if not called.
  */
 int picosat_res (PicoSAT *);
@@ -499,6 +509,10 @@ const int * picosat_failed_assumptions (PicoSAT *);
  * The last argument if non zero fixes assumptions.  In particular, if an
  * assumption can not be removed it is permanently assigned true, otherwise
  * if it turns out to be redundant it is permanently assumed to be false.
+ *
+ * If one of the internal calls to 'picosat_sat' is interrupted (see
+ * 'picosat_set_interrupt') the remaining assumptions are kept and the
+ * result is still unsatisfiable but not necessarily minimal.
  */
 const int * picosat_mus_assumptions (PicoSAT *, void *,
                                      void(*)(void*,const int*),int);
@@ -0,0 +1,303 @@
+/* Part of the generic incremental SAT API called 'ipasir'.
+ * See 'LICENSE' for rights to use this software.
+ */
+#ifndef ipasir_h_INCLUDED
+#define ipasir_h_INCLUDED
+
+/*
+ * In this header, the macro IPASIR_API is defined as follows:
+ * - if IPASIR_SHARED_LIB is not defined, then IPASIR_API is defined, but empty.
+ * - if IPASIR_SHARED_LIB is defined...
+ *    - ...and if BUILDING_IPASIR_SHARED_LIB is not defined, IPASIR_API is
+ *      defined to contain symbol visibility attributes for importing symbols
+ *      of a DSO (including the __declspec rsp. __attribute__ keywords).
+ *    - ...and if BUILDING_IPASIR_SHARED_LIB is defined, IPASIR_API is defined
+ *      to contain symbol visibility attributes for exporting symbols from a
+ *      DSO (including the __declspec rsp. __attribute__ keywords).
+ */
+
+#if defined(IPASIR_SHARED_LIB)
+    #if defined(_WIN32) || defined(__CYGWIN__)
+        #if defined(BUILDING_IPASIR_SHARED_LIB)
+            #if defined(__GNUC__)
+                #define IPASIR_API __attribute__((dllexport))
+            #elif defined(_MSC_VER)
+                #define IPASIR_API __declspec(dllexport)
+            #endif
+        #else
+            #if defined(__GNUC__)
+                #define IPASIR_API __attribute__((dllimport))
+            #elif defined(_MSC_VER)
+                #define IPASIR_API __declspec(dllimport)
+            #endif
+        #endif
+    #elif defined(__GNUC__)
+        #define IPASIR_API __attribute__((visibility("default")))
+    #endif
+
+    #if !defined(IPASIR_API)
+        #if !defined(IPASIR_SUPPRESS_WARNINGS)
+            #warning "Unknown compiler. Not adding visibility information to IPASIR symbols."
+            #warning "Define IPASIR_SUPPRESS_WARNINGS to suppress this warning."
+        #endif
+        #define IPASIR_API
+    #endif
+#else
+    #define IPASIR_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Return the name and the version of the incremental SAT
+ * solving library.
+ */
+IPASIR_API const char * ipasir_signature ();
+
+/**
+ * Construct a new solver and return a pointer to it.
+ * Use the returned pointer as the first parameter in each
+ * of the following functions.
+ *
+ * Required state: N/A
+ * State after: INPUT
+ */
+IPASIR_API void * ipasir_init ();
+
+/**
+ * Release the solver, i.e., all its resoruces and
+ * allocated memory (destructor). The solver pointer
+ * cannot be used for any purposes after this call.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: undefined
+ */
+IPASIR_API void ipasir_release (void * solver);
+
+/**
+ * Add the given literal into the currently added clause
+ * or finalize the clause with a 0.  Clauses added this way
+ * cannot be removed. The addition of removable clauses
+ * can be simulated using activation literals and assumptions.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT
+ *
+ * Literals are encoded as (non-zero) integers as in the
+ * DIMACS formats.  They have to be smaller or equal to
+ * INT_MAX and strictly larger than INT_MIN (to avoid
+ * negation overflow).  This applies to all the literal
+ * arguments in API functions.
+ */
+IPASIR_API void ipasir_add (void * solver, int lit_or_zero);
+
+/**
+ * Add an assumption for the next SAT search (the next call
+ * of ipasir_solve). After calling ipasir_solve all the
+ * previously added assumptions are cleared.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT
+ */
+IPASIR_API void ipasir_assume (void * solver, int lit);
+
+/**
+ * Solve the formula with specified clauses under the specified assumptions.
+ * If the formula is satisfiable the function returns 10 and the state of the solver is changed to SAT.
+ * If the formula is unsatisfiable the function returns 20 and the state of the solver is changed to UNSAT.
+ * If the search is interrupted (see ipasir_set_terminate) the function returns 0 and the state of the solver remains INPUT.
+ * This function can be called in any defined state of the solver.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API int ipasir_solve (void * solver);
+
+/**
+ * Get the truth value of the given literal in the found satisfying
+ * assignment. Return 'lit' if True, '-lit' if False, and 0 if not important.
+ * This function can only be used if ipasir_solve has returned 10
+ * and no 'ipasir_add' nor 'ipasir_assume' has been called
+ * since then, i.e., the state of the solver is SAT.
+ *
+ * Required state: SAT
+ * State after: SAT
+ */
+IPASIR_API int ipasir_val (void * solver, int lit);
+
+/**
+ * Check if the given assumption literal was used to prove the
+ * unsatisfiability of the formula under the assumptions
+ * used for the last SAT search. Return 1 if so, 0 otherwise.
+ * This function can only be used if ipasir_solve has returned 20 and
+ * no ipasir_add or ipasir_assume has been called since then, i.e.,
+ * the state of the solver is UNSAT.
+ *
+ * Required state: UNSAT
+ * State after: UNSAT
+ */
+IPASIR_API int ipasir_failed (void * solver, int lit);
+
+/**
+ * Set a callback function used to indicate a termination requirement to the
+ * solver. The solver will periodically call this function and check its return
+ * value during the search. The ipasir_set_terminate function can be called in any
+ * state of the solver, the state remains unchanged after the call.
+ * The callback function is of the form "int terminate(void * state)"
+ *   - it returns a non-zero value if the solver should terminate.
+ *   - the solver calls the callback function with the parameter "state"
+ *     having the value passed in the ipasir_set_terminate function (2nd parameter).
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_terminate (void * solver, void * state, int (*terminate)(void * state));
+
+/**
+ * Set a callback function used to extract learned clauses up to a given length from the
+ * solver. The solver will call this function for each learned clause that satisfies
+ * the maximum length (literal count) condition. The ipasir_set_learn function can be called in any
+ * state of the solver, the state remains unchanged after the call.
+ * The callback function is of the form "void learn(void * state, int * clause)"
+ *   - the solver calls the callback function with the parameter "state"
+ *     having the value passed in the ipasir_set_learn function (2nd parameter).
+ *   - the argument "clause" is a pointer to a null terminated integer array containing the learned clause.
+ *     the solver can change the data at the memory location that "clause" points to after the function call.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_learn (void * solver, void * state, int max_length, void (*learn)(void * state, int * clause));
+
+/*
+ * The following functions are non-standard extensions of IPASIR, which are
+ * implemented by all solvers packaged in this project.  They do not add new
+ * functionality but allow to exchange data with the solver in bulk, which
+ * avoids the per call overhead of foreign function interfaces, e.g., JNA.
+ */
+
+/**
+ * Add the literals 'lits[0]', ..., 'lits[size-1]' in this order as if
+ * ipasir_add was called for each of them.  The buffer can contain several
+ * clauses, each terminated by 0.  If the last literal is not 0, the last
+ * clause can be continued with further calls of ipasir_add or
+ * ipasir_add_clauses.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT
+ */
+IPASIR_API void ipasir_add_clauses (void * solver, const int * lits, int size);
+
+/**
+ * Get the truth values of all variables 'from', ..., 'to' in the found
+ * satisfying assignment at once.  The value of the variable 'from + i' is
+ * written to 'vals[i]' and is the same as returned by ipasir_val for it.
+ * The buffer has to provide space for 'to - from + 1' values.
+ *
+ * Required state: SAT
+ * State after: SAT
+ */
+IPASIR_API void ipasir_val_range (void * solver, int from, int to, int * vals);
+
+/**
+ * Same as ipasir_val_range but only the signs of the values are written,
+ * i.e., 1 for True, -1 for False, and 0 if not important, which allows to
+ * copy models using a quarter of the memory.
+ *
+ * Required state: SAT
+ * State after: SAT
+ */
+IPASIR_API void ipasir_model (void * solver, int from, int to, signed char * vals);
+
+/**
+ * Get all assumption literals for which ipasir_failed would return 1 at
+ * once.  At most 'size' of them are written to 'core' and the number of
+ * all failed assumptions is returned.  Thus a buffer with space for all
+ * assumptions used in the last SAT search is always large enough.
+ *
+ * Required state: UNSAT
+ * State after: UNSAT
+ */
+IPASIR_API int ipasir_failed_core (void * solver, int * core, int size);
+
+/**
+ * Same as ipasir_set_learn but the learned clauses are collected and
+ * passed on to 'learn' in batches, to reduce the number of calls.  Each
+ * batch consists of 'size' literals forming 0 terminated clauses, i.e., in
+ * the format of ipasir_add_clauses.  Pending clauses are passed on before
+ * ipasir_solve returns.  Setting this call-back replaces the one set by
+ * ipasir_set_learn and vice versa.  Solvers which do not support exporting
+ * learned clauses never call 'learn'.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_learn_batch (void * solver, void * state, int max_length, void (*learn)(void * state, const int * clauses, int size));
+
+/**
+ * Set a callback function used to import clauses, e.g., clauses learned by
+ * other solvers working on the same formula.  The solver polls 'import'
+ * regularly during the search (on restarts) and adds the returned clauses
+ * as learned clauses.  The callback returns a buffer with '*size' literals
+ * forming 0 terminated clauses, i.e., in the format of ipasir_add_clauses,
+ * which has to stay valid until the next call, or sets '*size' to 0 if
+ * there is nothing to import.  The imported clauses have to be implied by
+ * the formula.  Clauses with variables unknown to the solver are ignored.
+ * Solvers which do not support importing clauses never call 'import'.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_import (void * solver, void * state, const int * (*import)(void * state, int * size));
+
+/**
+ * Poll the callback set by ipasir_set_terminate only after 'conflicts'
+ * conflicts or if 'milliseconds' passed since the last poll, whichever
+ * comes first.  Non-positive values disable the respective condition and
+ * if both are disabled the callback is not polled at all.  By default the
+ * callback is polled on every conflict, which is costly if it is called
+ * through a foreign function interface.  Solvers may count their checks
+ * for termination instead of conflicts, e.g., CaDiCaL, or may poll even
+ * less often, e.g., PicoSAT every 1024 decisions.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT or SAT or UNSAT
+ */
+IPASIR_API void ipasir_set_terminate_interval (void * solver, int conflicts, int milliseconds);
+
+/**
+ * Ask the solver to terminate the currently running ipasir_solve, or the
+ * next one if it is not solving, which then returns 0.  Other than the
+ * callback set by ipasir_set_terminate this does not call out of the
+ * solver but only sets an atomic flag, which the solver checks before
+ * that callback.  Thus it can be called at any time from another thread or
+ * a signal handler.  The request is cleared as soon as ipasir_solve
+ * returns.
+ *
+ * Required state: INPUT or SAT or UNSAT or SOLVING
+ * State after: INPUT or SAT or UNSAT or SOLVING
+ */
+IPASIR_API void ipasir_interrupt (void * solver);
+
+/**
+ * Only propagate the 'size' literals in 'assumptions', together with those
+ * added before by ipasir_assume, on top of the literals fixed at the top
+ * level without any search.  Writes at most 'capacity' of the literals
+ * implied by the assumptions (including the assumptions themselves but not
+ * literals fixed at the top level) to 'implied' and returns the number of
+ * all of them, or -1 if propagation leads to a conflict.  Thus calling it
+ * again with a buffer of the returned size gives all implied literals.
+ * As after ipasir_solve all assumptions are cleared.
+ *
+ * Required state: INPUT or SAT or UNSAT
+ * State after: INPUT
+ */
+IPASIR_API int ipasir_propagate (void * solver, const int * assumptions, int size, int * implied, int capacity);
+
+#ifdef __cplusplus
+} // closing extern "C"
+#endif
+
+#endif
@@ -0,0 +1,469 @@
+/* Portfolio of the solvers packaged in this project behind the IPASIR
+ * interface.  Each worker is an instance of one of the solvers, possibly
+ * with different options.  Clauses and assumptions are recorded and passed
+ * on to all workers in bulk at the beginning of 'ipasir_solve', which then
+ * runs all workers in parallel, one thread each.  The first worker which
+ * finds an answer wins and all others are stopped through their terminate
+ * call-backs.  Models and failed assumptions are taken from the winner.
+ *
+ * The glue code of the solver modules is compiled with 'ipasirprefix.h',
+ * which renames 'ipasir_solve' to 'minisat_ipasir_solve' etc.
+ */
+#include "ipasir.h"
+#include "portfolio.h"
+
+#include "ccadical.h"
+extern "C" {
+#include "picosat.h"
+}
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/*------------------------------------------------------------------------*/
+
+#define DECLARE_BACKEND(S) \
+extern "C" { \
+const char * S ## _ipasir_signature (); \
+void * S ## _ipasir_init (); \
+void S ## _ipasir_release (void *); \
+void S ## _ipasir_assume (void *, int); \
+int S ## _ipasir_solve (void *); \
+int S ## _ipasir_val (void *, int); \
+int S ## _ipasir_failed (void *, int); \
+void S ## _ipasir_set_terminate (void *, void *, int (*)(void *)); \
+void S ## _ipasir_set_learn (void *, void *, int, void (*)(void *, int *)); \
+void S ## _ipasir_add_clauses (void *, const int *, int); \
+void S ## _ipasir_val_range (void *, int, int, int *); \
+void S ## _ipasir_model (void *, int, int, signed char *); \
+int S ## _ipasir_failed_core (void *, int *, int); \
+void S ## _ipasir_set_learn_batch (void *, void *, int, \
+  void (*)(void *, const int *, int)); \
+void S ## _ipasir_set_import (void *, void *, \
+  const int * (*)(void *, int *)); \
+void S ## _ipasir_set_terminate_interval (void *, int, int); \
+void S ## _ipasir_interrupt (void *); \
+int S ## _ipasir_propagate (void *, const int *, int, int *, int); \
+}
+
+#define BACKEND(S) { \
+  #S, \
+  S ## _ipasir_signature, \
+  S ## _ipasir_init, \
+  S ## _ipasir_release, \
+  S ## _ipasir_assume, \
+  S ## _ipasir_solve, \
+  S ## _ipasir_val, \
+  S ## _ipasir_failed, \
+  S ## _ipasir_set_terminate, \
+  S ## _ipasir_set_learn, \
+  S ## _ipasir_add_clauses, \
+  S ## _ipasir_val_range, \
+  S ## _ipasir_model, \
+  S ## _ipasir_failed_core, \
+  S ## _ipasir_set_learn_batch, \
+  S ## _ipasir_set_import, \
+  S ## _ipasir_set_terminate_interval, \
+  S ## _ipasir_interrupt, \
+  S ## _ipasir_propagate, \
+}
+
+DECLARE_BACKEND (cadical)
+DECLARE_BACKEND (minisat)
+DECLARE_BACKEND (picosat)
+
+extern "C" PicoSAT * ipasir_picosat (void *);   // see PicoSAT glue
+
+struct Backend {
+  const char * name;
+  const char * (*signature) ();
+  void * (*init) ();
+  void (*release) (void *);
+  void (*assume) (void *, int);
+  int (*solve) (void *);
+  int (*val) (void *, int);
+  int (*failed) (void *, int);
+  void (*set_terminate) (void *, void *, int (*)(void *));
+  void (*set_learn) (void *, void *, int, void (*)(void *, int *));
+  void (*add_clauses) (void *, const int *, int);
+  void (*val_range) (void *, int, int, int *);
+  void (*model) (void *, int, int, signed char *);
+  int (*failed_core) (void *, int *, int);
+  void (*set_learn_batch) (void *, void *, int,
+                           void (*)(void *, const int *, int));
+  void (*set_import) (void *, void *, const int * (*)(void *, int *));
+  void (*set_terminate_interval) (void *, int, int);
+  void (*interrupt) (void *);
+  int (*propagate) (void *, const int *, int, int *, int);
+};
+
+static const Backend backends[] = {
+  BACKEND (cadical),
+  BACKEND (minisat),
+  BACKEND (picosat),
+};
+
+static void die (const char * fmt, ...) {
+  va_list ap;
+  fputs ("*** ipasir portfolio error: ", stderr);
+  va_start (ap, fmt);
+  vfprintf (stderr, fmt, ap);
+  va_end (ap);
+  fputc ('\n', stderr);
+  exit (1);
+}
+
+/*------------------------------------------------------------------------*/
+
+class Portfolio;
+
+struct Worker {
+  Portfolio * portfolio;
+  const Backend * backend;
+  void * solver;
+  string spec;
+  int res;
+  size_t imported;              // position in 'Portfolio::imported'
+  bool importing;               // polls the importer (PicoSAT does not)
+  vector<int> buffer;           // imported clauses passed to 'solver'
+};
+
+class Portfolio {
+
+  // Not changed after construction, since call-backs refer to workers.
+  //
+  vector<Worker> workers;
+  vector<int> clauses;          // clauses added since the last 'solve'
+  vector<int> assumptions;      // assumptions for the next 'solve'
+  Worker * winner;
+
+  // Protects the following and is used to signal finished workers.
+  //
+  mutex solving;
+  condition_variable finished;
+  int running;
+  atomic<bool> stop;
+
+  // Set by 'interrupt' and cleared when 'solve' returns.
+  //
+  atomic<bool> terminating;
+
+  void * terminateState;
+  int (*terminateCallback) (void *);
+  chrono::milliseconds terminateInterval;   // of polling the call-back
+
+  // Serializes the user call-backs for learned and imported clauses.
+  // Imported clauses are collected in 'imported' for all workers until
+  // all importing workers got them.
+  //
+  mutex sharing;
+  void * learnState;
+  void (*learnCallback) (void *, int *);
+  void (*learnBatchCallback) (void *, const int *, int);
+  void * importState;
+  const int * (*importCallback) (void *, int *);
+  vector<int> imported;
+
+  static int stopping (void * state) {
+    Portfolio * p = (Portfolio *) state;
+    return p->stop || p->terminating;
+  }
+
+  static void learn (void * state, int * clause) {
+    Portfolio * p = ((Worker *) state)->portfolio;
+    lock_guard<mutex> guard (p->sharing);
+    if (p->learnCallback) p->learnCallback (p->learnState, clause);
+  }
+
+  static void learnBatch (void * state, const int * clauses, int size) {
+    Portfolio * p = ((Worker *) state)->portfolio;
+    lock_guard<mutex> guard (p->sharing);
+    if (p->learnBatchCallback)
+      p->learnBatchCallback (p->learnState, clauses, size);
+  }
+
+  // Every worker gets all clauses imported since its last call.
+  //
+  static const int * import (void * state, int * size) {
+    Worker * w = (Worker *) state;
+    Portfolio * p = w->portfolio;
+    lock_guard<mutex> guard (p->sharing);
+    int n = 0;
+    const int * lits = p->importCallback ?
+      p->importCallback (p->importState, &n) : 0;
+    if (n > 0) p->imported.insert (p->imported.end (), lits, lits + n);
+    w->buffer.assign (p->imported.begin () + w->imported, p->imported.end ());
+    w->imported = p->imported.size ();
+    p->flushImported ();
+    *size = (int) w->buffer.size ();
+    return w->buffer.data ();
+  }
+
+  // Drop the prefix of 'imported' which all importing workers already got.
+  // To keep this amortized it is only done if that is at least half of it.
+  //
+  void flushImported () {
+    size_t flush = imported.size ();
+    for (const auto & w : workers)
+      if (w.importing && w.imported < flush) flush = w.imported;
+    if (!flush || 2*flush < imported.size ()) return;
+    imported.erase (imported.begin (), imported.begin () + flush);
+    for (auto & w : workers)
+      w.imported = w.importing ? w.imported - flush : 0;
+  }
+
+  void configure (Worker & w, const string & setting) {
+    const char * name = w.backend->name;
+    const size_t pos = setting.find ('=');
+    if (!strcmp (name, "cadical")) {
+      CCaDiCaL * solver = (CCaDiCaL *) w.solver;
+      if (pos == string::npos) {
+        if (!ccadical_configure (solver, setting.c_str ()))
+          die ("invalid CaDiCaL configuration '%s'", setting.c_str ());
+      } else if (!ccadical_set_long_option (solver, ("--" + setting).c_str ()))
+        die ("invalid CaDiCaL option '%s'", setting.c_str ());
+    } else if (!strcmp (name, "picosat") && pos != string::npos &&
+               setting.substr (0, pos) == "seed" &&
+               setting.find_first_not_of ("0123456789", pos + 1) ==
+                 string::npos && pos + 1 < setting.size ())
+      picosat_set_seed (ipasir_picosat (w.solver),
+                        (unsigned) strtoul (setting.c_str () + pos + 1, 0, 10));
+    else die ("invalid setting '%s' for %s", setting.c_str (), name);
+  }
+
+  void add (const string & spec) {
+    size_t end = spec.find (':');
+    string name = spec.substr (0, end);
+    const Backend * backend = 0;
+    for (const auto & b : backends)
+      if (name == b.name) backend = &b;
+    if (!backend) die ("unknown solver '%s' in '%s'",
+                       name.c_str (), spec.c_str ());
+    workers.push_back (Worker ());
+    Worker & w = workers.back ();
+    w.portfolio = this;
+    w.backend = backend;
+    w.solver = backend->init ();
+    w.spec = spec;
+    w.res = 0;
+    w.imported = 0;
+    w.importing = false;
+    while (end != string::npos) {
+      size_t start = end + 1;
+      end = spec.find (':', start);
+      configure (w, spec.substr (start, end - start));
+    }
+    backend->set_terminate (w.solver, this, stopping);
+  }
+
+  void run (Worker * w) {
+    const Backend * b = w->backend;
+    if (!clauses.empty ())
+      b->add_clauses (w->solver, clauses.data (), (int) clauses.size ());
+    for (const auto & lit : assumptions)
+      b->assume (w->solver, lit);
+    int res = b->solve (w->solver);
+    lock_guard<mutex> guard (solving);
+    w->res = res;
+    if (res && !winner) winner = w, stop = true;
+    running--;
+    finished.notify_one ();
+  }
+
+public:
+
+  Portfolio (const char * spec) :
+    winner (0), running (0), stop (false), terminating (false),
+    terminateState (0), terminateCallback (0), terminateInterval (10),
+    learnState (0), learnCallback (0), learnBatchCallback (0),
+    importState (0), importCallback (0)
+  {
+    string workers_spec;
+    if (spec) workers_spec = spec;
+    else {
+      static const char * presets[] = {
+        "cadical", "minisat", "cadical:sat", "cadical:unsat", "picosat"
+      };
+      const unsigned n = max (1u, thread::hardware_concurrency ());
+      const unsigned m = sizeof presets / sizeof *presets;
+      for (unsigned i = 0; i < n; i++) {
+        if (i) workers_spec += ',';
+        if (i < m) workers_spec += presets[i];
+        else workers_spec += "cadical:seed=" + to_string (i);
+      }
+    }
+    size_t start = 0, end;
+    do {
+      end = workers_spec.find (',', start);
+      add (workers_spec.substr (start, end - start));
+      start = end + 1;
+    } while (end != string::npos);
+  }
+
+  ~Portfolio () {
+    for (auto & w : workers)
+      w.backend->release (w.solver);
+  }
+
+  void add (int lit) { clauses.push_back (lit); }
+  void add (const int * lits, int size) {
+    clauses.insert (clauses.end (), lits, lits + size);
+  }
+  void assume (int lit) { assumptions.push_back (lit); }
+
+  int solve () {
+    winner = 0;
+    stop = false;
+    running = (int) workers.size ();
+    vector<thread> threads;
+    for (auto & w : workers)
+      threads.emplace_back (&Portfolio::run, this, &w);
+    {
+      unique_lock<mutex> lock (solving);
+      while (running) {
+        if (!stop && terminateCallback) {
+          lock.unlock ();
+          const bool terminate = terminateCallback (terminateState);
+          lock.lock ();
+          if (terminate) stop = true;
+        }
+        finished.wait_for (lock, terminateInterval);
+      }
+    }
+    for (auto & t : threads)
+      t.join ();
+    clauses.clear ();
+    assumptions.clear ();
+    terminating = false;
+    return winner ? winner->res : 0;
+  }
+
+  int val (int lit) {
+    return winner ? winner->backend->val (winner->solver, lit) : 0;
+  }
+  void vals (int from, int to, int * res) {
+    if (winner) winner->backend->val_range (winner->solver, from, to, res);
+  }
+  void vals (int from, int to, signed char * res) {
+    if (winner) winner->backend->model (winner->solver, from, to, res);
+  }
+  int failed (int lit) {
+    return winner ? winner->backend->failed (winner->solver, lit) : 0;
+  }
+  int failed (int * core, int size) {
+    return winner ?
+      winner->backend->failed_core (winner->solver, core, size) : 0;
+  }
+  const char * winning () { return winner ? winner->spec.c_str () : 0; }
+
+  // Propagation is cheap and gives the same result for all workers.  Thus
+  // only the first one is asked, after all of them got the new clauses.
+  //
+  int propagate (const int * lits, int size, int * implied, int capacity) {
+    if (!clauses.empty ()) {
+      for (auto & w : workers)
+        w.backend->add_clauses (w.solver, clauses.data (),
+                                (int) clauses.size ());
+      clauses.clear ();
+    }
+    assumptions.insert (assumptions.end (), lits, lits + size);
+    Worker & w = workers[0];
+    int res = w.backend->propagate (w.solver, assumptions.data (),
+                                    (int) assumptions.size (),
+                                    implied, capacity);
+    assumptions.clear ();
+    winner = 0;
+    return res;
+  }
+
+  void setTerminate (void * state, int (*terminate)(void *)) {
+    terminateState = state;
+    terminateCallback = terminate;
+  }
+
+  // The call-back is polled by the thread calling 'solve' only, which does
+  // not see any conflicts.  Thus only the time interval is used.
+  //
+  void setTerminateInterval (int milliseconds) {
+    terminateInterval = chrono::milliseconds (milliseconds > 0 ?
+                                              milliseconds : 10);
+  }
+
+  void interrupt () { terminating = true; }
+
+  void setLearn (void * state, int max_length,
+                 void (*clause)(void *, int *),
+                 void (*batch)(void *, const int *, int)) {
+    lock_guard<mutex> guard (sharing);
+    learnState = state;
+    learnCallback = clause;
+    learnBatchCallback = batch;
+    for (auto & w : workers)
+      if (batch) w.backend->set_learn_batch (w.solver, &w, max_length,
+                                             learnBatch);
+      else w.backend->set_learn (w.solver, &w, max_length,
+                                 clause ? learn : 0);
+  }
+
+  void setImport (void * state, const int * (*callback)(void *, int *)) {
+    lock_guard<mutex> guard (sharing);
+    importState = state;
+    importCallback = callback;
+    for (auto & w : workers) {
+      w.importing = callback && strcmp (w.backend->name, "picosat");
+      w.backend->set_import (w.solver, &w, callback ? import : 0);
+    }
+    flushImported ();
+  }
+};
+
+/*------------------------------------------------------------------------*/
+
+extern "C" {
+static Portfolio * import (void * s) { return (Portfolio *) s; }
+const char * ipasir_signature () {
+  static string sig;
+  static once_flag initialized;
+  call_once (initialized, [] {
+    sig = "portfolio[";
+    for (const auto & b : backends) {
+      if (&b != backends) sig += ',';
+      sig += b.signature ();
+    }
+    sig += ']';
+  });
+  return sig.c_str ();
+}
+void * ipasir_init () { return new Portfolio (getenv ("IPASIR_PORTFOLIO")); }
+void * ipasir_portfolio_init (const char * spec) { return new Portfolio (spec); }
+void ipasir_release (void * s) { delete import (s); }
+int ipasir_solve (void * s) { return import (s)->solve (); }
+void ipasir_add (void * s, int l) { import (s)->add (l); }
+void ipasir_add_clauses (void * s, const int * l, int n) { import (s)->add (l, n); }
+void ipasir_assume (void * s, int l) { import (s)->assume (l); }
+int ipasir_val (void * s, int l) { return import (s)->val (l); }
+void ipasir_val_range (void * s, int f, int t, int * v) { import (s)->vals (f, t, v); }
+void ipasir_model (void * s, int f, int t, signed char * v) { import (s)->vals (f, t, v); }
+int ipasir_failed (void * s, int l) { return import (s)->failed (l); }
+int ipasir_failed_core (void * s, int * c, int n) { return import (s)->failed (c, n); }
+const char * ipasir_portfolio_winner (void * s) { return import (s)->winning (); }
+void ipasir_set_terminate (void * s, void * state, int (*callback)(void * state)) { import (s)->setTerminate (state, callback); }
+void ipasir_set_learn (void * s, void * state, int max_length, void (*learn)(void * state, int * clause)) { import (s)->setLearn (state, max_length, learn, 0); }
+void ipasir_set_learn_batch (void * s, void * state, int max_length, void (*learn)(void * state, const int * clauses, int size)) { import (s)->setLearn (state, max_length, 0, learn); }
+void ipasir_set_import (void * s, void * state, const int * (*callback)(void * state, int * size)) { import (s)->setImport (state, callback); }
+void ipasir_set_terminate_interval (void * s, int conflicts, int milliseconds) { import (s)->setTerminateInterval (milliseconds); }
+void ipasir_interrupt (void * s) { import (s)->interrupt (); }
+int ipasir_propagate (void * s, const int * a, int n, int * i, int c) { return import (s)->propagate (a, n, i, c); }
+};
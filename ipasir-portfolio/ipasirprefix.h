@@ -0,0 +1,42 @@
+/* Force included ('-include ipasirprefix.h') when compiling the glue code
+ * of the solver modules for the portfolio.  It renames all functions
+ * declared in 'ipasir.h' to '<IPASIR_PREFIX>_ipasir_...', e.g., with
+ * '-DIPASIR_PREFIX=minisat' 'ipasir_solve' becomes 'minisat_ipasir_solve'.
+ * This allows to link the glue code of several solvers into one library.
+ * Functions added to 'ipasir.h' have to be added here too.
+ */
+#ifndef IPASIR_PREFIX
+#error "IPASIR_PREFIX undefined"
+#endif
+
+#define IPASIR_PASTE_(PREFIX,NAME) PREFIX ## _ ## NAME
+#define IPASIR_PASTE(PREFIX,NAME) IPASIR_PASTE_(PREFIX,NAME)
+
+#define ipasir_signature IPASIR_PASTE(IPASIR_PREFIX,ipasir_signature)
+#define ipasir_init IPASIR_PASTE(IPASIR_PREFIX,ipasir_init)
+#define ipasir_release IPASIR_PASTE(IPASIR_PREFIX,ipasir_release)
+#define ipasir_add IPASIR_PASTE(IPASIR_PREFIX,ipasir_add)
+#define ipasir_assume IPASIR_PASTE(IPASIR_PREFIX,ipasir_assume)
+#define ipasir_solve IPASIR_PASTE(IPASIR_PREFIX,ipasir_solve)
+#define ipasir_val IPASIR_PASTE(IPASIR_PREFIX,ipasir_val)
+#define ipasir_failed IPASIR_PASTE(IPASIR_PREFIX,ipasir_failed)
+#define ipasir_set_terminate IPASIR_PASTE(IPASIR_PREFIX,ipasir_set_terminate)
+#define ipasir_set_learn IPASIR_PASTE(IPASIR_PREFIX,ipasir_set_learn)
+#define ipasir_add_clauses IPASIR_PASTE(IPASIR_PREFIX,ipasir_add_clauses)
+#define ipasir_val_range IPASIR_PASTE(IPASIR_PREFIX,ipasir_val_range)
+#define ipasir_model IPASIR_PASTE(IPASIR_PREFIX,ipasir_model)
+#define ipasir_failed_core IPASIR_PASTE(IPASIR_PREFIX,ipasir_failed_core)
+#define ipasir_set_learn_batch IPASIR_PASTE(IPASIR_PREFIX,ipasir_set_learn_batch)
+#define ipasir_set_import IPASIR_PASTE(IPASIR_PREFIX,ipasir_set_import)
+#define ipasir_set_terminate_interval IPASIR_PASTE(IPASIR_PREFIX,ipasir_set_terminate_interval)
+#define ipasir_interrupt IPASIR_PASTE(IPASIR_PREFIX,ipasir_interrupt)
+#define ipasir_propagate IPASIR_PASTE(IPASIR_PREFIX,ipasir_propagate)
+#define ipasir_backbone IPASIR_PASTE(IPASIR_PREFIX,ipasir_backbone)
+#define ipasir_enumerate IPASIR_PASTE(IPASIR_PREFIX,ipasir_enumerate)
+#define ipasir_shrink_core IPASIR_PASTE(IPASIR_PREFIX,ipasir_shrink_core)
+#define ipasir_picosat_mus IPASIR_PASTE(IPASIR_PREFIX,ipasir_picosat_mus)
+#define ipasir_picosat_mcs IPASIR_PASTE(IPASIR_PREFIX,ipasir_picosat_mcs)
+#define ipasir_push IPASIR_PASTE(IPASIR_PREFIX,ipasir_push)
+#define ipasir_pop IPASIR_PASTE(IPASIR_PREFIX,ipasir_pop)
+#define ipasir_reset IPASIR_PASTE(IPASIR_PREFIX,ipasir_reset)
+#define ipasir_pool IPASIR_PASTE(IPASIR_PREFIX,ipasir_pool)
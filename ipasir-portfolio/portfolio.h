@@ -0,0 +1,34 @@
+/* Non-standard functions of the portfolio library in addition to 'ipasir.h'.
+ * See 'README' for the format of worker specifications.
+ */
+#ifndef portfolio_h_INCLUDED
+#define portfolio_h_INCLUDED
+
+#include "ipasir.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Same as ipasir_init but the workers are given by 'spec', e.g.,
+ * "cadical:sat,cadical:unsat,minisat,picosat:seed=1", instead of
+ * the environment variable 'IPASIR_PORTFOLIO'.  If 'spec' is 0 the
+ * default portfolio with one worker per hardware thread is used.
+ */
+IPASIR_API void * ipasir_portfolio_init (const char * spec);
+
+/**
+ * Return the specification of the worker which produced the result of the
+ * last call of ipasir_solve, or 0 if that returned 0.
+ *
+ * Required state: SAT or UNSAT
+ * State after: SAT or UNSAT
+ */
+IPASIR_API const char * ipasir_portfolio_winner (void * solver);
+
+#ifdef __cplusplus
+} // closing extern "C"
+#endif
+
+#endif